@@ -0,0 +1,243 @@
+#ifndef CPP_ALGORITHMS_ALGORITHMS_HASH_OPERATORS_HASH_OPERATORS_H_
+#define CPP_ALGORITHMS_ALGORITHMS_HASH_OPERATORS_HASH_OPERATORS_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "dynamic_array.h"
+#include "hash_map.h"
+#include "hash_multi_map.h"
+#include "parallel_for.h"
+
+// Hash join and group-by over random access ranges. Both operators first
+// radix-partition their input by the high bits of the (mixed) key hash, so the
+// hash table built for each partition fits in the L2 cache, and then process
+// the partitions independently on up to `thread_count` threads. Keys are
+// hashed with `Hash`, the same policy the hash containers use.
+
+constexpr std::size_t kL2CacheSize{256 * 1024};
+constexpr std::size_t kMaxPartitionBits{10};
+
+template <class Range>
+using range_value_t =
+    typename std::iterator_traits<decltype(std::begin(
+        std::declval<const Range&>()))>::value_type;
+
+template <class KeyFunction, class Value>
+using key_result_t =
+    std::decay_t<std::invoke_result_t<KeyFunction&, const Value&>>;
+
+// Smallest number of partition bits for which a partition of `count`
+// elements, each taking `element_size` bytes of hash table, fits in L2.
+inline std::size_t PartitionBits(const std::size_t count,
+                                 const std::size_t element_size) {
+  std::size_t bits{0};
+  while (bits < kMaxPartitionBits &&
+         (count >> bits) * element_size > kL2CacheSize) {
+    ++bits;
+  }
+  return bits;
+}
+
+inline std::size_t PartitionOf(const std::size_t hash,
+                               const std::size_t bits) {
+  if (bits == 0) return 0;
+  // Identity hashes (e.g. std::hash<int>) leave the high bits empty.
+  const std::uint64_t mixed{static_cast<std::uint64_t>(hash) *
+                            0x9E3779B97F4A7C15ull};
+  return static_cast<std::size_t>(mixed >> (64 - bits));
+}
+
+// Scatters the indices of [first, first + count) into `partitioned` grouped by
+// partition and returns the offset of every partition, followed by `count`.
+// Each thread histograms and scatters its own chunk, so the relative order of
+// elements is kept inside a partition.
+template <class Hash, class RandomIt, class KeyFunction>
+DynamicArray<std::size_t> RadixPartition(
+    const RandomIt first, const std::size_t count, KeyFunction& key_function,
+    const std::size_t bits, const std::size_t thread_count,
+    DynamicArray<std::size_t>& partitioned) {
+  const std::size_t partition_count{std::size_t{1} << bits};
+  const std::size_t chunk_count{
+      std::max<std::size_t>(1, std::min(thread_count, count))};
+  auto chunk_begin = [&](const std::size_t chunk) -> std::size_t {
+    return count * chunk / chunk_count;
+  };
+
+  DynamicArray<std::size_t> partitions;
+  partitions.Resize(count);
+  DynamicArray<std::size_t> cursors;
+  cursors.Resize(chunk_count * partition_count, 0);
+
+  ParallelFor(chunk_count, thread_count, [&](const std::size_t chunk) {
+    std::size_t* const histogram{&cursors[chunk * partition_count]};
+    for (std::size_t i{chunk_begin(chunk)}; i < chunk_begin(chunk + 1); ++i) {
+      partitions[i] = PartitionOf(Hash{}(key_function(first[i])), bits);
+      ++histogram[partitions[i]];
+    }
+  });
+
+  DynamicArray<std::size_t> offsets;
+  offsets.Resize(partition_count + 1);
+  std::size_t offset{0};
+  for (std::size_t partition{0}; partition < partition_count; ++partition) {
+    offsets[partition] = offset;
+    for (std::size_t chunk{0}; chunk < chunk_count; ++chunk) {
+      std::size_t& cursor{cursors[chunk * partition_count + partition]};
+      const std::size_t size{cursor};
+      cursor = offset;
+      offset += size;
+    }
+  }
+  offsets[partition_count] = count;
+
+  partitioned.Resize(count);
+  ParallelFor(chunk_count, thread_count, [&](const std::size_t chunk) {
+    std::size_t* const cursor{&cursors[chunk * partition_count]};
+    for (std::size_t i{chunk_begin(chunk)}; i < chunk_begin(chunk + 1); ++i) {
+      partitioned[cursor[partitions[i]]++] = i;
+    }
+  });
+
+  return offsets;
+}
+
+// Returns a (build element, probe element) pointer pair for every pair of
+// elements with equal keys. The pointers refer into the input ranges, which
+// must outlive the result. Matches are grouped by partition and otherwise
+// follow the order of the probe range.
+template <class BuildRange, class ProbeRange, class KeyFunction,
+          class Hash = std::hash<
+              key_result_t<KeyFunction, range_value_t<BuildRange>>>>
+DynamicArray<std::pair<const range_value_t<BuildRange>*,
+                       const range_value_t<ProbeRange>*>>
+HashJoin(const BuildRange& build, const ProbeRange& probe,
+         KeyFunction key_function,
+         const std::size_t thread_count = DefaultThreadCount()) {
+  using BuildValue = range_value_t<BuildRange>;
+  using ProbeValue = range_value_t<ProbeRange>;
+  using Key = key_result_t<KeyFunction, BuildValue>;
+  using Match = std::pair<const BuildValue*, const ProbeValue*>;
+
+  const auto build_first{std::begin(build)};
+  const auto probe_first{std::begin(probe)};
+  const std::size_t build_size{
+      static_cast<std::size_t>(std::distance(build_first, std::end(build)))};
+  const std::size_t probe_size{
+      static_cast<std::size_t>(std::distance(probe_first, std::end(probe)))};
+
+  DynamicArray<Match> matches;
+  if (build_size == 0 || probe_size == 0) return matches;
+
+  const std::size_t bits{PartitionBits(
+      build_size, sizeof(Key) + sizeof(std::size_t) + 4 * sizeof(void*))};
+  DynamicArray<std::size_t> build_partitioned;
+  const DynamicArray<std::size_t> build_offsets{RadixPartition<Hash>(
+      build_first, build_size, key_function, bits, thread_count,
+      build_partitioned)};
+  DynamicArray<std::size_t> probe_partitioned;
+  const DynamicArray<std::size_t> probe_offsets{RadixPartition<Hash>(
+      probe_first, probe_size, key_function, bits, thread_count,
+      probe_partitioned)};
+
+  const std::size_t partition_count{build_offsets.Size() - 1};
+  DynamicArray<DynamicArray<Match>> partition_matches;
+  partition_matches.Resize(partition_count);
+
+  ParallelFor(partition_count, thread_count, [&](const std::size_t partition) {
+    if (build_offsets[partition] == build_offsets[partition + 1]) return;
+
+    HashMultiMap<Key, std::size_t, Hash> table;
+    table.Reserve(build_offsets[partition + 1] - build_offsets[partition]);
+    for (std::size_t i{build_offsets[partition]};
+         i < build_offsets[partition + 1]; ++i) {
+      const std::size_t index{build_partitioned[i]};
+      table.Insert({key_function(build_first[index]), index});
+    }
+
+    DynamicArray<Match>& result{partition_matches[partition]};
+    for (std::size_t i{probe_offsets[partition]};
+         i < probe_offsets[partition + 1]; ++i) {
+      const std::size_t index{probe_partitioned[i]};
+      const ProbeValue* const probe_value{&probe_first[index]};
+      const auto [first, last] = table.EqualRange(key_function(*probe_value));
+      for (auto it{first}; it != last; ++it) {
+        result.PushBack({&build_first[it->second], probe_value});
+      }
+    }
+  });
+
+  std::size_t match_count{0};
+  for (const DynamicArray<Match>& result : partition_matches) {
+    match_count += result.Size();
+  }
+  matches.Reserve(match_count);
+  for (const DynamicArray<Match>& result : partition_matches) {
+    for (const Match& match : result) {
+      matches.PushBack(match);
+    }
+  }
+  return matches;
+}
+
+// Folds every element of `range` into the `Accumulator` of its key with
+// `aggregate(Accumulator&, const value_type&)`. Accumulators start out value
+// initialized, and elements of a group are folded in range order.
+template <class Accumulator, class Range, class KeyFunction, class Aggregate,
+          class Hash =
+              std::hash<key_result_t<KeyFunction, range_value_t<Range>>>>
+HashMap<key_result_t<KeyFunction, range_value_t<Range>>, Accumulator, Hash>
+GroupByAggregate(const Range& range, KeyFunction key_function,
+                 Aggregate aggregate,
+                 const std::size_t thread_count = DefaultThreadCount()) {
+  using Key = key_result_t<KeyFunction, range_value_t<Range>>;
+  using Groups = HashMap<Key, Accumulator, Hash>;
+
+  const auto first{std::begin(range)};
+  const std::size_t size{
+      static_cast<std::size_t>(std::distance(first, std::end(range)))};
+
+  Groups groups;
+  if (size == 0) return groups;
+
+  const std::size_t bits{PartitionBits(
+      size, sizeof(Key) + sizeof(Accumulator) + 2 * sizeof(void*))};
+  DynamicArray<std::size_t> partitioned;
+  const DynamicArray<std::size_t> offsets{RadixPartition<Hash>(
+      first, size, key_function, bits, thread_count, partitioned)};
+
+  const std::size_t partition_count{offsets.Size() - 1};
+  DynamicArray<Groups> partition_groups;
+  partition_groups.Resize(partition_count);
+
+  ParallelFor(partition_count, thread_count, [&](const std::size_t partition) {
+    Groups& local_groups{partition_groups[partition]};
+    for (std::size_t i{offsets[partition]}; i < offsets[partition + 1]; ++i) {
+      const auto& value{first[partitioned[i]]};
+      const Key key{key_function(value)};
+
+      auto it{local_groups.Find(key)};
+      if (it == local_groups.end())
+        it = local_groups.Insert({key, Accumulator{}}).first;
+      aggregate(it->second, value);
+    }
+  });
+
+  std::size_t group_count{0};
+  for (const Groups& local_groups : partition_groups) {
+    group_count += local_groups.Size();
+  }
+  // Partitions never share a key, so the merge is a plain insertion.
+  groups.Reserve(group_count);
+  for (const Groups& local_groups : partition_groups) {
+    groups.Insert(local_groups.begin(), local_groups.end());
+  }
+  return groups;
+}
+
+#endif  // CPP_ALGORITHMS_ALGORITHMS_HASH_OPERATORS_HASH_OPERATORS_H_
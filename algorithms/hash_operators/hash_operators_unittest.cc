@@ -0,0 +1,172 @@
+#include "hash_operators.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dynamic_array.h"
+
+struct Order {
+  int customer;
+  int amount;
+};
+
+struct Customer {
+  int id;
+  std::string name;
+};
+
+// Partition bits
+
+TEST(HashOperatorsTest, PartitionBits) {
+  EXPECT_EQ(PartitionBits(0, 64), 0);
+  EXPECT_EQ(PartitionBits(kL2CacheSize / 64, 64), 0);
+  EXPECT_EQ(PartitionBits(kL2CacheSize / 64 + 1, 64), 1);
+  EXPECT_EQ(PartitionBits(kL2CacheSize, 64), 6);
+  EXPECT_EQ(PartitionBits(SIZE_MAX / 64, 64), kMaxPartitionBits);
+}
+
+TEST(HashOperatorsTest, RadixPartition) {
+  DynamicArray<int> values;
+  for (int i{0}; i < 1000; ++i) {
+    values.PushBack(i % 100);
+  }
+  auto identity = [](const int value) -> int { return value; };
+
+  DynamicArray<std::size_t> partitioned;
+  const DynamicArray<std::size_t> offsets{RadixPartition<std::hash<int>>(
+      values.begin(), values.Size(), identity, 3, 4, partitioned)};
+  ASSERT_EQ(offsets.Size(), 9);
+  EXPECT_EQ(offsets.Back(), values.Size());
+
+  DynamicArray<std::size_t> sorted{partitioned};
+  std::sort(sorted.begin(), sorted.end());
+  for (std::size_t i{0}; i < sorted.Size(); ++i) {
+    EXPECT_EQ(sorted[i], i);
+  }
+
+  for (std::size_t partition{0}; partition + 1 < offsets.Size(); ++partition) {
+    for (std::size_t i{offsets[partition]}; i < offsets[partition + 1]; ++i) {
+      const int value{values[partitioned[i]]};
+      EXPECT_EQ(PartitionOf(std::hash<int>{}(value), 3), partition);
+      if (i > offsets[partition]) {
+        EXPECT_LT(partitioned[i - 1], partitioned[i]);
+      }
+    }
+  }
+}
+
+// Hash join
+
+TEST(HashOperatorsTest, HashJoin) {
+  const std::vector<Customer> customers{{1, "ann"}, {2, "bob"}, {3, "eve"}};
+  const std::vector<Order> orders{{1, 10}, {3, 30}, {4, 40}, {1, 11}};
+
+  auto key = [](const auto& value) -> int {
+    if constexpr (std::is_same_v<std::decay_t<decltype(value)>, Order>) {
+      return value.customer;
+    } else {
+      return value.id;
+    }
+  };
+
+  const auto matches{HashJoin(customers, orders, key)};
+  ASSERT_EQ(matches.Size(), 3);
+
+  std::vector<std::pair<std::string, int>> rows;
+  for (const auto& [customer, order] : matches) {
+    rows.push_back({customer->name, order->amount});
+  }
+  std::sort(rows.begin(), rows.end());
+
+  const std::vector<std::pair<std::string, int>> expected{
+      {"ann", 10}, {"ann", 11}, {"eve", 30}};
+  EXPECT_EQ(rows, expected);
+}
+
+TEST(HashOperatorsTest, HashJoin_Empty) {
+  const std::vector<int> empty;
+  const std::vector<int> values{1, 2, 3};
+  auto identity = [](const int value) -> int { return value; };
+
+  EXPECT_TRUE(HashJoin(empty, values, identity).Empty());
+  EXPECT_TRUE(HashJoin(values, empty, identity).Empty());
+}
+
+TEST(HashOperatorsTest, HashJoin_Partitioned) {
+  DynamicArray<int> build;
+  DynamicArray<int> probe;
+  for (int i{0}; i < 100000; ++i) {
+    build.PushBack(i);
+    probe.PushBack(i % 3 == 0 ? i / 3 : -1 - i);
+  }
+  probe.PushBack(7);
+  auto identity = [](const int value) -> int { return value; };
+
+  ASSERT_GT(PartitionBits(build.Size(), sizeof(int) + 5 * sizeof(void*)), 0);
+
+  for (const std::size_t thread_count : {1, 4}) {
+    const auto matches{HashJoin(build, probe, identity, thread_count)};
+    EXPECT_EQ(matches.Size(), 33334 + 1);
+    for (const auto& [build_value, probe_value] : matches) {
+      EXPECT_EQ(*build_value, *probe_value);
+    }
+  }
+}
+
+TEST(HashOperatorsTest, HashJoin_Duplicates) {
+  const DynamicArray<int> build{1, 1, 2};
+  const DynamicArray<int> probe{1, 1, 1, 2, 3};
+  auto identity = [](const int value) -> int { return value; };
+
+  EXPECT_EQ(HashJoin(build, probe, identity).Size(), 2 * 3 + 1);
+}
+
+// Group by
+
+TEST(HashOperatorsTest, GroupByAggregate) {
+  const std::vector<Order> orders{{1, 10}, {3, 30}, {4, 40}, {1, 11}};
+
+  const auto totals{GroupByAggregate<int>(
+      orders, [](const Order& order) -> int { return order.customer; },
+      [](int& total, const Order& order) -> void { total += order.amount; })};
+  EXPECT_EQ(totals.Size(), 3);
+  EXPECT_EQ(totals.At(1).second, 21);
+  EXPECT_EQ(totals.At(3).second, 30);
+  EXPECT_EQ(totals.At(4).second, 40);
+}
+
+TEST(HashOperatorsTest, GroupByAggregate_Partitioned) {
+  DynamicArray<int> values;
+  for (int i{0}; i < 200000; ++i) {
+    values.PushBack(i);
+  }
+  auto key = [](const int value) -> int { return value % 50000; };
+  auto count = [](std::size_t& count, int) -> void { ++count; };
+
+  for (const std::size_t thread_count : {1, 4}) {
+    const auto counts{
+        GroupByAggregate<std::size_t>(values, key, count, thread_count)};
+    ASSERT_EQ(counts.Size(), 50000);
+    for (const auto& [key, count] : counts) {
+      EXPECT_EQ(count, 4);
+    }
+  }
+}
+
+TEST(HashOperatorsTest, GroupByAggregate_Order) {
+  const std::vector<std::pair<char, char>> values{
+      {'a', 'x'}, {'b', 'y'}, {'a', 'z'}, {'a', 'w'}};
+
+  const auto groups{GroupByAggregate<std::string>(
+      values, [](const auto& value) -> char { return value.first; },
+      [](std::string& group, const auto& value) -> void {
+        group += value.second;
+      })};
+  EXPECT_EQ(groups.At('a').second, "xzw");
+  EXPECT_EQ(groups.At('b').second, "y");
+}
@@ -0,0 +1,264 @@
+#ifndef CPP_ALGORITHMS_ALGORITHMS_PARALLEL_SORT_PARALLEL_SORT_H_
+#define CPP_ALGORITHMS_ALGORITHMS_PARALLEL_SORT_PARALLEL_SORT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+
+#include "dynamic_array.h"
+#include "parallel_for.h"
+#include "sorting.h"
+
+// Ranges shorter than this per thread are not worth splitting up.
+constexpr std::size_t kParallelSortThreshold{1 << 14};
+constexpr std::size_t kSampleSortOversampling{32};
+constexpr std::size_t kMergeSortRunSize{32};
+
+inline std::size_t ParallelSortThreads(const std::size_t size,
+                                       const std::size_t thread_count,
+                                       const std::size_t sequential_threshold) {
+  return std::max<std::size_t>(
+      1, std::min(thread_count,
+                  size / std::max<std::size_t>(sequential_threshold, 1)));
+}
+
+// Sample sort
+
+// Unstable parallel sort. Splitters drawn from a random sample divide the
+// range into buckets, each thread scatters a chunk of the range into the
+// buckets, and the buckets are then sorted independently with PdqSort.
+// Ranges shorter than `sequential_threshold` per thread are sorted in place
+// on fewer threads, down to a plain PdqSort.
+template <class RandomIt, class Compare = std::less<>>
+void ParallelSort(const RandomIt first, const RandomIt last,
+                  Compare compare = Compare(),
+                  std::size_t thread_count = DefaultThreadCount(),
+                  const std::size_t sequential_threshold =
+                      kParallelSortThreshold) {
+  using T = iterator_value_t<RandomIt>;
+
+  const std::size_t size{static_cast<std::size_t>(last - first)};
+  thread_count = ParallelSortThreads(size, thread_count, sequential_threshold);
+  if (thread_count == 1) {
+    PdqSort(first, last, compare);
+    return;
+  }
+
+  // Twice as many buckets as threads evens out unlucky splitters.
+  const std::size_t bucket_count{thread_count * 2};
+  const std::size_t chunk_count{thread_count};
+  const std::size_t chunk_size{(size + chunk_count - 1) / chunk_count};
+
+  DynamicArray<T> splitters;
+  {
+    std::mt19937_64 generator{size};
+    std::uniform_int_distribution<std::size_t> distribution{0, size - 1};
+
+    DynamicArray<T> sample;
+    sample.Reserve(bucket_count * kSampleSortOversampling);
+    for (std::size_t i{0}; i < bucket_count * kSampleSortOversampling; ++i) {
+      sample.PushBack(first[distribution(generator)]);
+    }
+    PdqSort(sample.begin(), sample.end(), compare);
+
+    splitters.Reserve(bucket_count - 1);
+    for (std::size_t bucket{1}; bucket < bucket_count; ++bucket) {
+      splitters.PushBack(sample[bucket * kSampleSortOversampling]);
+    }
+  }
+
+  // Classification: the bucket of every element and per chunk bucket sizes.
+  DynamicArray<std::uint32_t> buckets;
+  buckets.ResizeUninitialized(size);
+  DynamicArray<std::size_t> offsets;
+  offsets.Resize(chunk_count * bucket_count);
+
+  ParallelFor(chunk_count, thread_count, [&](const std::size_t chunk) {
+    const std::size_t begin{std::min(chunk * chunk_size, size)};
+    const std::size_t end{std::min(begin + chunk_size, size)};
+    std::size_t* const counts{offsets.Data() + chunk * bucket_count};
+
+    for (std::size_t i{begin}; i < end; ++i) {
+      const auto bucket{static_cast<std::uint32_t>(
+          std::upper_bound(splitters.begin(), splitters.end(), first[i],
+                           compare) -
+          splitters.begin())};
+      buckets[i] = bucket;
+      ++counts[bucket];
+    }
+  });
+
+  // Turn the counts into scatter offsets, bucket by bucket.
+  DynamicArray<std::size_t> bucket_offsets;
+  bucket_offsets.Reserve(bucket_count + 1);
+  std::size_t offset{0};
+  for (std::size_t bucket{0}; bucket < bucket_count; ++bucket) {
+    bucket_offsets.PushBack(offset);
+    for (std::size_t chunk{0}; chunk < chunk_count; ++chunk) {
+      const std::size_t count{offsets[chunk * bucket_count + bucket]};
+      offsets[chunk * bucket_count + bucket] = offset;
+      offset += count;
+    }
+  }
+  bucket_offsets.PushBack(offset);
+
+  DynamicArray<T> scratch;
+  ResizeScratch(scratch, size);
+
+  ParallelFor(chunk_count, thread_count, [&](const std::size_t chunk) {
+    const std::size_t begin{std::min(chunk * chunk_size, size)};
+    const std::size_t end{std::min(begin + chunk_size, size)};
+    std::size_t* const chunk_offsets{offsets.Data() + chunk * bucket_count};
+
+    for (std::size_t i{begin}; i < end; ++i) {
+      scratch[chunk_offsets[buckets[i]]++] = std::move(first[i]);
+    }
+  });
+
+  ParallelFor(bucket_count, thread_count, [&](const std::size_t bucket) {
+    const std::size_t begin{bucket_offsets[bucket]};
+    const std::size_t end{bucket_offsets[bucket + 1]};
+
+    std::move(scratch.Data() + begin, scratch.Data() + end, first + begin);
+    PdqSort(first + begin, first + end, compare);
+  });
+}
+
+// Merge sort
+
+// Number of elements of `a` among the first `k` of the stable merge of `a`
+// and `b`, found by binary search along the merge path.
+template <class InputIt, class Compare>
+std::size_t MergePathSplit(const InputIt a, const std::size_t a_size,
+                           const InputIt b, const std::size_t b_size,
+                           const std::size_t k, Compare& compare) {
+  std::size_t low{k > b_size ? k - b_size : 0};
+  std::size_t high{std::min(k, a_size)};
+  while (low < high) {
+    const std::size_t middle{low + (high - low) / 2};
+    if (!compare(b[k - middle - 1], a[middle])) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+// Moves the outputs [k_begin, k_end) of the stable merge of `a` and `b` to
+// `out + k_begin`.
+template <class InputIt, class OutputIt, class Compare>
+void MergeSlice(const InputIt a, const std::size_t a_size, const InputIt b,
+                const std::size_t b_size, const std::size_t k_begin,
+                const std::size_t k_end, const OutputIt out,
+                Compare& compare) {
+  const std::size_t a_begin{MergePathSplit(a, a_size, b, b_size, k_begin,
+                                           compare)};
+  const std::size_t a_end{MergePathSplit(a, a_size, b, b_size, k_end,
+                                         compare)};
+
+  std::merge(std::make_move_iterator(a + a_begin),
+             std::make_move_iterator(a + a_end),
+             std::make_move_iterator(b + (k_begin - a_begin)),
+             std::make_move_iterator(b + (k_end - a_end)), out + k_begin,
+             compare);
+}
+
+// Merges neighbouring runs of `width` elements from `source` to
+// `destination`, splitting each merge into `pieces` independent tasks.
+template <class InputIt, class OutputIt, class Compare>
+void MergePass(const InputIt source, const OutputIt destination,
+               const std::size_t size, const std::size_t width,
+               const std::size_t pieces, const std::size_t thread_count,
+               Compare& compare) {
+  const std::size_t pair_count{(size + 2 * width - 1) / (2 * width)};
+
+  ParallelFor(pair_count * pieces, thread_count, [&](const std::size_t task) {
+    const std::size_t begin{task / pieces * 2 * width};
+    const std::size_t middle{std::min(begin + width, size)};
+    const std::size_t end{std::min(begin + 2 * width, size)};
+    const std::size_t piece{task % pieces};
+
+    MergeSlice(source + begin, middle - begin, source + middle, end - middle,
+               (end - begin) * piece / pieces,
+               (end - begin) * (piece + 1) / pieces, destination + begin,
+               compare);
+  });
+}
+
+// Stable bottom-up merge sort of a range using `buffer`, which must hold as
+// many elements as the range.
+template <class RandomIt, class BufferIt, class Compare>
+void MergeSort(const RandomIt first, const RandomIt last, const BufferIt buffer,
+               Compare& compare) {
+  const std::size_t size{static_cast<std::size_t>(last - first)};
+  for (std::size_t begin{0}; begin < size; begin += kMergeSortRunSize) {
+    InsertionSort(first + begin,
+                  first + std::min(begin + kMergeSortRunSize, size), compare);
+  }
+
+  bool in_buffer{false};
+  for (std::size_t width{kMergeSortRunSize}; width < size; width *= 2) {
+    if (in_buffer) {
+      MergePass(buffer, first, size, width, 1, 1, compare);
+    } else {
+      MergePass(first, buffer, size, width, 1, 1, compare);
+    }
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer) std::move(buffer, buffer + size, first);
+}
+
+// Stable parallel sort. Every thread merge sorts a run of the range, and the
+// runs are then merged pairwise, with each merge split along its merge path
+// so that all threads stay busy up to the final one. Needs a scratch
+// DynamicArray as large as the range.
+template <class RandomIt, class Compare = std::less<>>
+void ParallelStableSort(const RandomIt first, const RandomIt last,
+                        Compare compare = Compare(),
+                        std::size_t thread_count = DefaultThreadCount(),
+                        const std::size_t sequential_threshold =
+                            kParallelSortThreshold) {
+  using T = iterator_value_t<RandomIt>;
+
+  const std::size_t size{static_cast<std::size_t>(last - first)};
+  if (size < 2) return;
+  thread_count = ParallelSortThreads(size, thread_count, sequential_threshold);
+
+  DynamicArray<T> scratch;
+  ResizeScratch(scratch, size);
+  T* const buffer{scratch.Data()};
+
+  const std::size_t run_size{(size + thread_count - 1) / thread_count};
+  ParallelFor(thread_count, thread_count, [&](const std::size_t run) {
+    const std::size_t begin{std::min(run * run_size, size)};
+    const std::size_t end{std::min(begin + run_size, size)};
+    MergeSort(first + begin, first + end, buffer + begin, compare);
+  });
+
+  bool in_scratch{false};
+  for (std::size_t width{run_size}; width < size; width *= 2) {
+    const std::size_t pair_count{(size + 2 * width - 1) / (2 * width)};
+    const std::size_t pieces{(thread_count + pair_count - 1) / pair_count};
+    if (in_scratch) {
+      MergePass(buffer, first, size, width, pieces, thread_count, compare);
+    } else {
+      MergePass(first, buffer, size, width, pieces, thread_count, compare);
+    }
+    in_scratch = !in_scratch;
+  }
+
+  if (in_scratch) {
+    ParallelFor(thread_count, thread_count, [&](const std::size_t run) {
+      const std::size_t begin{std::min(run * run_size, size)};
+      const std::size_t end{std::min(begin + run_size, size)};
+      std::move(buffer + begin, buffer + end, first + begin);
+    });
+  }
+}
+
+#endif  // CPP_ALGORITHMS_ALGORITHMS_PARALLEL_SORT_PARALLEL_SORT_H_
@@ -0,0 +1,158 @@
+#include "parallel_sort.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "dynamic_array.h"
+
+// Small enough that the tests exercise the parallel paths.
+constexpr std::size_t kThreshold{64};
+
+struct Record {
+  int key;
+  std::size_t position;
+};
+
+DynamicArray<int> RandomArray(const std::size_t size, const int max) {
+  std::mt19937 generator{static_cast<std::mt19937::result_type>(size)};
+  std::uniform_int_distribution<int> distribution{-max, max};
+
+  DynamicArray<int> dynamic_array;
+  for (std::size_t i{0}; i < size; ++i) {
+    dynamic_array.PushBack(distribution(generator));
+  }
+  return dynamic_array;
+}
+
+DynamicArray<Record> RandomRecords(const std::size_t size, const int max) {
+  DynamicArray<Record> records;
+  for (const int key : RandomArray(size, max)) {
+    records.PushBack({key, records.Size()});
+  }
+  return records;
+}
+
+void ExpectStablySorted(const DynamicArray<Record>& records) {
+  for (std::size_t i{1}; i < records.Size(); ++i) {
+    ASSERT_LE(records[i - 1].key, records[i].key);
+    if (records[i - 1].key == records[i].key) {
+      ASSERT_LT(records[i - 1].position, records[i].position);
+    }
+  }
+}
+
+// Sample sort
+
+TEST(ParallelSortTest, ParallelSort) {
+  for (const std::size_t size : {0, 1, 63, 1000, 100000}) {
+    for (const int max : {3, 1 << 30}) {
+      for (const std::size_t thread_count : {1, 3, 8}) {
+        DynamicArray<int> dynamic_array{RandomArray(size, max)};
+        DynamicArray<int> expected{dynamic_array};
+        std::sort(expected.begin(), expected.end());
+
+        ParallelSort(dynamic_array.begin(), dynamic_array.end(), std::less<>(),
+                     thread_count, kThreshold);
+        ASSERT_EQ(dynamic_array, expected)
+            << "size " << size << ", threads " << thread_count;
+      }
+    }
+  }
+}
+
+TEST(ParallelSortTest, ParallelSort_Sorted) {
+  DynamicArray<int> dynamic_array;
+  for (int i{0}; i < 10000; ++i) {
+    dynamic_array.PushBack(i);
+  }
+  DynamicArray<int> expected{dynamic_array};
+  std::reverse(dynamic_array.begin(), dynamic_array.end());
+
+  ParallelSort(dynamic_array.begin(), dynamic_array.end(), std::less<>(), 4,
+               kThreshold);
+  EXPECT_EQ(dynamic_array, expected);
+}
+
+TEST(ParallelSortTest, ParallelSort_NonTrivial) {
+  DynamicArray<std::string> dynamic_array;
+  for (const int value : RandomArray(5000, 1000)) {
+    dynamic_array.PushBack(std::to_string(value));
+  }
+  DynamicArray<std::string> expected{dynamic_array};
+  std::sort(expected.begin(), expected.end(), std::greater<>());
+
+  ParallelSort(dynamic_array.begin(), dynamic_array.end(), std::greater<>(),
+               4, kThreshold);
+  EXPECT_EQ(dynamic_array, expected);
+}
+
+TEST(ParallelSortTest, ParallelSort_Exception) {
+  DynamicArray<int> dynamic_array{RandomArray(1000, 100)};
+
+  EXPECT_THROW(ParallelSort(
+                   dynamic_array.begin(), dynamic_array.end(),
+                   [](const int a, const int b) -> bool {
+                     if (a == 100 || b == 100) throw std::runtime_error{"100"};
+                     return a < b;
+                   },
+                   4, kThreshold),
+               std::runtime_error);
+}
+
+// Merge sort
+
+TEST(ParallelSortTest, MergePathSplit) {
+  const int a[]{1, 3, 3, 5};
+  const int b[]{2, 3, 4};
+  std::less<> compare;
+
+  // Merged: 1a 2b 3a 3a 3b 4b 5a
+  const std::size_t expected[]{0, 1, 1, 2, 3, 3, 3, 4};
+  for (std::size_t k{0}; k <= 7; ++k) {
+    EXPECT_EQ(MergePathSplit(a, 4, b, 3, k, compare), expected[k]) << k;
+  }
+}
+
+TEST(ParallelSortTest, ParallelStableSort) {
+  for (const std::size_t size : {0, 1, 63, 1000, 100000}) {
+    for (const int max : {3, 1 << 30}) {
+      for (const std::size_t thread_count : {1, 3, 8}) {
+        DynamicArray<Record> records{RandomRecords(size, max)};
+
+        ParallelStableSort(
+            records.begin(), records.end(),
+            [](const Record& a, const Record& b) { return a.key < b.key; },
+            thread_count, kThreshold);
+        ASSERT_EQ(records.Size(), size);
+        ExpectStablySorted(records);
+      }
+    }
+  }
+}
+
+TEST(ParallelSortTest, ParallelStableSort_NonTrivial) {
+  DynamicArray<std::string> dynamic_array;
+  for (const int value : RandomArray(5000, 1000)) {
+    dynamic_array.PushBack(std::to_string(value));
+  }
+  DynamicArray<std::string> expected{dynamic_array};
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const std::string& a, const std::string& b) {
+                     return a.size() < b.size();
+                   });
+
+  ParallelStableSort(
+      dynamic_array.begin(), dynamic_array.end(),
+      [](const std::string& a, const std::string& b) {
+        return a.size() < b.size();
+      },
+      5, kThreshold);
+  EXPECT_EQ(dynamic_array, expected);
+}
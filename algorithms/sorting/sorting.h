@@ -0,0 +1,475 @@
+#ifndef CPP_ALGORITHMS_ALGORITHMS_SORTING_SORTING_H_
+#define CPP_ALGORITHMS_ALGORITHMS_SORTING_SORTING_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "dynamic_array.h"
+
+// Comparison sorts (introsort, pattern-defeating quicksort and a branchless
+// sorting network for small ranges) and an LSD radix sort over random access
+// iterators, e.g. those of DynamicArray and Array.
+
+constexpr std::size_t kSmallSortThreshold{16};
+constexpr std::size_t kInsertionSortThreshold{24};
+constexpr std::size_t kNintherThreshold{128};
+constexpr std::size_t kPartialInsertionSortLimit{8};
+
+template <class RandomIt>
+using iterator_value_t = typename std::iterator_traits<RandomIt>::value_type;
+
+// Whether compare-exchanges on the type compile to conditional moves.
+template <class RandomIt>
+constexpr bool is_branchless_sortable =
+    std::is_arithmetic_v<iterator_value_t<RandomIt>> ||
+    std::is_pointer_v<iterator_value_t<RandomIt>>;
+
+// Insertion sort
+
+template <class RandomIt, class Compare = std::less<>>
+void InsertionSort(const RandomIt first, const RandomIt last,
+                   Compare compare = Compare()) {
+  if (first == last) return;
+
+  for (RandomIt it{first + 1}; it != last; ++it) {
+    RandomIt sift{it};
+    RandomIt sift_prev{it - 1};
+    if (!compare(*sift, *sift_prev)) continue;
+
+    iterator_value_t<RandomIt> value{std::move(*sift)};
+    do {
+      *sift-- = std::move(*sift_prev);
+    } while (sift != first && compare(value, *--sift_prev));
+    *sift = std::move(value);
+  }
+}
+
+// Like InsertionSort, but requires an element not greater than any in the
+// range right before `first`, which stops the inner loop without a check.
+template <class RandomIt, class Compare>
+void UnguardedInsertionSort(const RandomIt first, const RandomIt last,
+                            Compare compare) {
+  if (first == last) return;
+
+  for (RandomIt it{first + 1}; it != last; ++it) {
+    RandomIt sift{it};
+    RandomIt sift_prev{it - 1};
+    if (!compare(*sift, *sift_prev)) continue;
+
+    iterator_value_t<RandomIt> value{std::move(*sift)};
+    do {
+      *sift-- = std::move(*sift_prev);
+    } while (compare(value, *--sift_prev));
+    *sift = std::move(value);
+  }
+}
+
+// Insertion sort that gives up once it has moved more than a few elements.
+// Returns whether the range ended up sorted.
+template <class RandomIt, class Compare>
+bool PartialInsertionSort(const RandomIt first, const RandomIt last,
+                          Compare compare) {
+  if (first == last) return true;
+
+  std::size_t moves{0};
+  for (RandomIt it{first + 1}; it != last; ++it) {
+    RandomIt sift{it};
+    RandomIt sift_prev{it - 1};
+    if (compare(*sift, *sift_prev)) {
+      iterator_value_t<RandomIt> value{std::move(*sift)};
+      do {
+        *sift-- = std::move(*sift_prev);
+      } while (sift != first && compare(value, *--sift_prev));
+      *sift = std::move(value);
+      moves += static_cast<std::size_t>(it - sift);
+    }
+
+    if (moves > kPartialInsertionSortLimit) return false;
+  }
+  return true;
+}
+
+// Small sort
+
+template <class T, class Compare>
+void CompareExchange(T& a, T& b, Compare& compare) {
+  const bool swap{static_cast<bool>(compare(b, a))};
+  const T low{swap ? b : a};
+  b = swap ? a : b;
+  a = low;
+}
+
+// Batcher's odd-even merge network truncated to the range size. The
+// comparators only depend on the size, so for arithmetic types the whole sort
+// runs without data-dependent branches. Meant for ranges of up to
+// kSmallSortThreshold elements.
+template <class RandomIt, class Compare = std::less<>>
+void SmallSort(const RandomIt first, const RandomIt last,
+               Compare compare = Compare()) {
+  const std::size_t size{static_cast<std::size_t>(last - first)};
+
+  for (std::size_t p{1}; p < size; p *= 2) {
+    for (std::size_t k{p}; k >= 1; k /= 2) {
+      for (std::size_t j{k % p}; j + k < size; j += 2 * k) {
+        for (std::size_t i{0}; i < std::min(k, size - j - k); ++i) {
+          if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+            CompareExchange(first[i + j], first[i + j + k], compare);
+        }
+      }
+    }
+  }
+}
+
+// Heap sort
+
+template <class RandomIt, class Compare = std::less<>>
+void HeapSort(const RandomIt first, const RandomIt last,
+              Compare compare = Compare()) {
+  std::make_heap(first, last, compare);
+  std::sort_heap(first, last, compare);
+}
+
+// Partitioning
+
+template <class RandomIt, class Compare>
+void Sort2(const RandomIt a, const RandomIt b, Compare& compare) {
+  if (compare(*b, *a)) std::iter_swap(a, b);
+}
+
+template <class RandomIt, class Compare>
+void Sort3(const RandomIt a, const RandomIt b, const RandomIt c,
+           Compare& compare) {
+  Sort2(a, b, compare);
+  Sort2(b, c, compare);
+  Sort2(a, b, compare);
+}
+
+// Partitions around the pivot at `first`, with elements equal to it going
+// right. Requires an element not less than the pivot at `last - 1`. Returns
+// the pivot position and whether the range was already partitioned.
+template <class RandomIt, class Compare>
+std::pair<RandomIt, bool> PartitionRight(const RandomIt first,
+                                         const RandomIt last,
+                                         Compare& compare) {
+  iterator_value_t<RandomIt> pivot{std::move(*first)};
+  RandomIt left{first};
+  RandomIt right{last};
+
+  while (compare(*++left, pivot)) {
+  }
+  if (left - 1 == first) {
+    while (left < right && !compare(*--right, pivot)) {
+    }
+  } else {
+    while (!compare(*--right, pivot)) {
+    }
+  }
+
+  const bool already_partitioned{left >= right};
+  while (left < right) {
+    std::iter_swap(left, right);
+    while (compare(*++left, pivot)) {
+    }
+    while (!compare(*--right, pivot)) {
+    }
+  }
+
+  const RandomIt pivot_position{left - 1};
+  *first = std::move(*pivot_position);
+  *pivot_position = std::move(pivot);
+  return {pivot_position, already_partitioned};
+}
+
+// Partitions around the pivot at `first`, with elements equal to it going
+// left. Used when the pivot equals the element before the range, in which
+// case the whole left part equals the pivot and needs no further sorting.
+template <class RandomIt, class Compare>
+RandomIt PartitionLeft(const RandomIt first, const RandomIt last,
+                       Compare& compare) {
+  iterator_value_t<RandomIt> pivot{std::move(*first)};
+  RandomIt left{first};
+  RandomIt right{last};
+
+  while (compare(pivot, *--right)) {
+  }
+  if (right + 1 == last) {
+    while (left < right && !compare(pivot, *++left)) {
+    }
+  } else {
+    while (!compare(pivot, *++left)) {
+    }
+  }
+
+  while (left < right) {
+    std::iter_swap(left, right);
+    while (compare(pivot, *--right)) {
+    }
+    while (!compare(pivot, *++left)) {
+    }
+  }
+
+  *first = std::move(*right);
+  *right = std::move(pivot);
+  return right;
+}
+
+inline std::size_t Log2(std::size_t size) {
+  std::size_t log{0};
+  while (size >>= 1) ++log;
+  return log;
+}
+
+// Introsort
+
+template <class RandomIt, class Compare>
+void IntroSortLoop(RandomIt first, RandomIt last, Compare& compare,
+                   std::size_t depth_limit) {
+  while (static_cast<std::size_t>(last - first) > kInsertionSortThreshold) {
+    if (depth_limit-- == 0) {
+      HeapSort(first, last, compare);
+      return;
+    }
+
+    const std::size_t half{static_cast<std::size_t>(last - first) / 2};
+    Sort3(first + half, first, last - 1, compare);
+    const RandomIt pivot{PartitionRight(first, last, compare).first};
+
+    // Recurse into the smaller side to bound the stack depth.
+    if (pivot - first < last - pivot) {
+      IntroSortLoop(first, pivot, compare, depth_limit);
+      first = pivot + 1;
+    } else {
+      IntroSortLoop(pivot + 1, last, compare, depth_limit);
+      last = pivot;
+    }
+  }
+}
+
+// Median-of-three quicksort that falls back to heap sort past 2 log n levels
+// and leaves short ranges to a final insertion sort.
+template <class RandomIt, class Compare = std::less<>>
+void IntroSort(const RandomIt first, const RandomIt last,
+               Compare compare = Compare()) {
+  if (last - first < 2) return;
+
+  IntroSortLoop(first, last, compare,
+                2 * Log2(static_cast<std::size_t>(last - first)));
+  InsertionSort(first, last, compare);
+}
+
+// Pattern-defeating quicksort
+
+template <class RandomIt, class Compare>
+void PdqSortLoop(RandomIt first, const RandomIt last, Compare& compare,
+                 std::size_t bad_allowed, bool leftmost) {
+  while (true) {
+    const std::size_t size{static_cast<std::size_t>(last - first)};
+
+    if (size < kInsertionSortThreshold) {
+      if constexpr (is_branchless_sortable<RandomIt>) {
+        if (size <= kSmallSortThreshold) {
+          SmallSort(first, last, compare);
+          return;
+        }
+      }
+      if (leftmost) {
+        InsertionSort(first, last, compare);
+      } else {
+        UnguardedInsertionSort(first, last, compare);
+      }
+      return;
+    }
+
+    // Median of three, or pseudo median of nine for large ranges, to `first`.
+    const std::size_t half{size / 2};
+    if (size > kNintherThreshold) {
+      Sort3(first, first + half, last - 1, compare);
+      Sort3(first + 1, first + (half - 1), last - 2, compare);
+      Sort3(first + 2, first + (half + 1), last - 3, compare);
+      Sort3(first + (half - 1), first + half, first + (half + 1), compare);
+      std::iter_swap(first, first + half);
+    } else {
+      Sort3(first + half, first, last - 1, compare);
+    }
+
+    // A pivot equal to the element before the range means many equal
+    // elements: put them all left and only keep sorting the rest.
+    if (!leftmost && !compare(*(first - 1), *first)) {
+      first = PartitionLeft(first, last, compare) + 1;
+      continue;
+    }
+
+    const auto [pivot, already_partitioned] =
+        PartitionRight(first, last, compare);
+    const std::size_t left_size{static_cast<std::size_t>(pivot - first)};
+    const std::size_t right_size{static_cast<std::size_t>(last - pivot) - 1};
+
+    if (left_size < size / 8 || right_size < size / 8) {
+      if (--bad_allowed == 0) {
+        HeapSort(first, last, compare);
+        return;
+      }
+
+      // Break up patterns that keep producing bad pivots.
+      if (left_size >= kInsertionSortThreshold) {
+        std::iter_swap(first, first + left_size / 4);
+        std::iter_swap(pivot - 1, pivot - left_size / 4);
+        if (left_size > kNintherThreshold) {
+          std::iter_swap(first + 1, first + (left_size / 4 + 1));
+          std::iter_swap(first + 2, first + (left_size / 4 + 2));
+          std::iter_swap(pivot - 2, pivot - (left_size / 4 + 1));
+          std::iter_swap(pivot - 3, pivot - (left_size / 4 + 2));
+        }
+      }
+      if (right_size >= kInsertionSortThreshold) {
+        std::iter_swap(pivot + 1, pivot + (1 + right_size / 4));
+        std::iter_swap(last - 1, last - right_size / 4);
+        if (right_size > kNintherThreshold) {
+          std::iter_swap(pivot + 2, pivot + (2 + right_size / 4));
+          std::iter_swap(pivot + 3, pivot + (3 + right_size / 4));
+          std::iter_swap(last - 2, last - (1 + right_size / 4));
+          std::iter_swap(last - 3, last - (2 + right_size / 4));
+        }
+      }
+    } else if (already_partitioned &&
+               PartialInsertionSort(first, pivot, compare) &&
+               PartialInsertionSort(pivot + 1, last, compare)) {
+      // Likely an already sorted input.
+      return;
+    }
+
+    PdqSortLoop(first, pivot, compare, bad_allowed, leftmost);
+    first = pivot + 1;
+    leftmost = false;
+  }
+}
+
+// Quicksort that adapts to sorted, reversed and repetitive inputs in linear
+// time and, like introsort, degrades to heap sort instead of O(n^2).
+template <class RandomIt, class Compare = std::less<>>
+void PdqSort(const RandomIt first, const RandomIt last,
+             Compare compare = Compare()) {
+  if (last - first < 2) return;
+
+  PdqSortLoop(first, last, compare,
+              Log2(static_cast<std::size_t>(last - first)), true);
+}
+
+template <class RandomIt, class Compare = std::less<>>
+void Sort(const RandomIt first, const RandomIt last,
+          Compare compare = Compare()) {
+  PdqSort(first, last, compare);
+}
+
+// Sizes a scratch buffer that is only ever assigned to, leaving trivial
+// elements uninitialized.
+template <class T>
+void ResizeScratch(DynamicArray<T>& scratch, const std::size_t size) {
+  if constexpr (std::is_trivially_default_constructible_v<T> &&
+                std::is_trivially_destructible_v<T>) {
+    scratch.ResizeUninitialized(size);
+  } else {
+    scratch.Resize(size);
+  }
+}
+
+// Radix sort
+
+struct IdentityKey {
+  template <class T>
+  const T& operator()(const T& value) const noexcept {
+    return value;
+  }
+};
+
+// Maps an arithmetic key to an unsigned integer with the same order.
+template <class Key>
+auto RadixKey(const Key key) {
+  static_assert(std::is_arithmetic_v<Key>, "radix keys must be arithmetic");
+
+  if constexpr (std::is_floating_point_v<Key>) {
+    static_assert(sizeof(Key) == 4 || sizeof(Key) == 8,
+                  "unsupported floating point size");
+    using Bits = std::conditional_t<sizeof(Key) == 4, std::uint32_t,
+                                    std::uint64_t>;
+    constexpr Bits kSignBit{Bits{1} << (sizeof(Bits) * 8 - 1)};
+
+    Bits bits;
+    std::memcpy(&bits, &key, sizeof(bits));
+    return static_cast<Bits>((bits & kSignBit) ? ~bits : bits | kSignBit);
+  } else if constexpr (std::is_signed_v<Key>) {
+    using Bits = std::make_unsigned_t<Key>;
+    constexpr Bits kSignBit{static_cast<Bits>(Bits{1}
+                                              << (sizeof(Bits) * 8 - 1))};
+    return static_cast<Bits>(static_cast<Bits>(key) ^ kSignBit);
+  } else {
+    return static_cast<std::make_unsigned_t<
+        std::conditional_t<std::is_same_v<Key, bool>, unsigned char, Key>>>(
+        key);
+  }
+}
+
+// Stable least-significant-digit radix sort by the arithmetic key that
+// `key_function` extracts from each element. Sorts a byte per pass through a
+// scratch DynamicArray, and skips passes in which all keys share the byte.
+template <class RandomIt, class KeyFunction = IdentityKey>
+void RadixSort(const RandomIt first, const RandomIt last,
+               KeyFunction key_function = KeyFunction()) {
+  using T = iterator_value_t<RandomIt>;
+  using Bits = decltype(RadixKey(key_function(*first)));
+  constexpr std::size_t kDigits{sizeof(Bits)};
+  constexpr std::size_t kRadix{256};
+
+  const std::size_t size{static_cast<std::size_t>(last - first)};
+  if (size < 2) return;
+
+  auto digit = [&](const T& value, const std::size_t pass) -> std::size_t {
+    return (RadixKey(key_function(value)) >> (pass * 8)) & 0xFF;
+  };
+
+  std::size_t counts[kDigits][kRadix]{};
+  for (RandomIt it{first}; it != last; ++it) {
+    const Bits key{RadixKey(key_function(*it))};
+    for (std::size_t pass{0}; pass < kDigits; ++pass) {
+      ++counts[pass][(key >> (pass * 8)) & 0xFF];
+    }
+  }
+
+  DynamicArray<T> scratch;
+  ResizeScratch(scratch, size);
+
+  bool in_scratch{false};
+  for (std::size_t pass{0}; pass < kDigits; ++pass) {
+    std::size_t* const count{counts[pass]};
+    if (count[digit(*first, pass)] == size) continue;
+
+    std::size_t offsets[kRadix];
+    std::size_t offset{0};
+    for (std::size_t i{0}; i < kRadix; ++i) {
+      offsets[i] = offset;
+      offset += count[i];
+    }
+
+    if (in_scratch) {
+      for (T& value : scratch) {
+        first[offsets[digit(value, pass)]++] = std::move(value);
+      }
+    } else {
+      for (RandomIt it{first}; it != last; ++it) {
+        scratch[offsets[digit(*it, pass)]++] = std::move(*it);
+      }
+    }
+    in_scratch = !in_scratch;
+  }
+
+  if (in_scratch) std::move(scratch.begin(), scratch.end(), first);
+}
+
+#endif  // CPP_ALGORITHMS_ALGORITHMS_SORTING_SORTING_H_
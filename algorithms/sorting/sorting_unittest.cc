@@ -0,0 +1,191 @@
+#include "sorting.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+
+#include "array.h"
+#include "dynamic_array.h"
+
+struct Record {
+  std::int64_t key;
+  std::size_t position;
+};
+
+DynamicArray<int> RandomArray(const std::size_t size, const int max) {
+  std::mt19937 generator{static_cast<std::mt19937::result_type>(size)};
+  std::uniform_int_distribution<int> distribution{-max, max};
+
+  DynamicArray<int> dynamic_array;
+  for (std::size_t i{0}; i < size; ++i) {
+    dynamic_array.PushBack(distribution(generator));
+  }
+  return dynamic_array;
+}
+
+// Inputs that tend to break naive quicksorts.
+DynamicArray<DynamicArray<int>> Patterns(const std::size_t size) {
+  DynamicArray<DynamicArray<int>> patterns;
+  patterns.PushBack(RandomArray(size, 1 << 30));
+  patterns.PushBack(RandomArray(size, 4));
+
+  DynamicArray<int> ascending;
+  DynamicArray<int> descending;
+  DynamicArray<int> organ_pipe;
+  DynamicArray<int> sawtooth;
+  for (std::size_t i{0}; i < size; ++i) {
+    const int value{static_cast<int>(i)};
+    ascending.PushBack(value);
+    descending.PushBack(-value);
+    organ_pipe.PushBack(i < size / 2 ? value : static_cast<int>(size) - value);
+    sawtooth.PushBack(value % 32);
+  }
+  patterns.PushBack(ascending);
+  patterns.PushBack(descending);
+  patterns.PushBack(organ_pipe);
+  patterns.PushBack(sawtooth);
+
+  DynamicArray<int> almost_sorted{ascending};
+  if (size > 1) std::swap(almost_sorted[0], almost_sorted[size - 1]);
+  patterns.PushBack(almost_sorted);
+  return patterns;
+}
+
+template <class SortFunction>
+void ExpectSortsPatterns(SortFunction sort) {
+  for (const std::size_t size : {0, 1, 2, 5, 16, 23, 24, 100, 129, 5000}) {
+    for (DynamicArray<int> pattern : Patterns(size)) {
+      DynamicArray<int> expected{pattern};
+      std::sort(expected.begin(), expected.end());
+
+      sort(pattern.begin(), pattern.end());
+      ASSERT_EQ(pattern, expected) << "size " << size;
+    }
+  }
+}
+
+// Insertion sort
+
+TEST(SortingTest, InsertionSort) {
+  DynamicArray<std::string> dynamic_array{"d", "b", "a", "c", "b"};
+  InsertionSort(dynamic_array.begin(), dynamic_array.end());
+  EXPECT_EQ(dynamic_array,
+            (DynamicArray<std::string>{"a", "b", "b", "c", "d"}));
+
+  InsertionSort(dynamic_array.begin(), dynamic_array.end(),
+                std::greater<>());
+  EXPECT_EQ(dynamic_array,
+            (DynamicArray<std::string>{"d", "c", "b", "b", "a"}));
+}
+
+// Small sort
+
+TEST(SortingTest, SmallSort) {
+  for (std::size_t size{0}; size <= kSmallSortThreshold; ++size) {
+    for (int max : {2, 1000}) {
+      DynamicArray<int> dynamic_array{RandomArray(size, max)};
+      DynamicArray<int> expected{dynamic_array};
+      std::sort(expected.begin(), expected.end());
+
+      SmallSort(dynamic_array.begin(), dynamic_array.end());
+      ASSERT_EQ(dynamic_array, expected) << "size " << size;
+    }
+  }
+}
+
+TEST(SortingTest, SmallSort_Array) {
+  Array<double, 7> array{3.5, -1.0, 2.0, 0.0, 9.25, -7.5, 2.0};
+
+  SmallSort(array.begin(), array.end(), std::greater<>());
+  EXPECT_EQ(array, (Array<double, 7>{9.25, 3.5, 2.0, 2.0, 0.0, -1.0, -7.5}));
+}
+
+// Introsort
+
+TEST(SortingTest, IntroSort) {
+  ExpectSortsPatterns([](auto first, auto last) { IntroSort(first, last); });
+}
+
+// Pattern-defeating quicksort
+
+TEST(SortingTest, PdqSort) {
+  ExpectSortsPatterns([](auto first, auto last) { PdqSort(first, last); });
+}
+
+TEST(SortingTest, PdqSort_NonTrivial) {
+  DynamicArray<std::string> dynamic_array;
+  for (const int value : RandomArray(1000, 50)) {
+    dynamic_array.PushBack(std::to_string(value));
+  }
+  DynamicArray<std::string> expected{dynamic_array};
+  std::sort(expected.begin(), expected.end(), std::greater<>());
+
+  PdqSort(dynamic_array.begin(), dynamic_array.end(), std::greater<>());
+  EXPECT_EQ(dynamic_array, expected);
+}
+
+TEST(SortingTest, Sort_Array) {
+  Array<int, 6> array{5, 3, 6, 1, 4, 2};
+
+  Sort(array.begin(), array.end());
+  EXPECT_EQ(array, (Array<int, 6>{1, 2, 3, 4, 5, 6}));
+}
+
+// Radix sort
+
+TEST(SortingTest, RadixSort) {
+  ExpectSortsPatterns([](auto first, auto last) { RadixSort(first, last); });
+}
+
+TEST(SortingTest, RadixSort_Unsigned) {
+  DynamicArray<std::uint64_t> dynamic_array{
+      UINT64_MAX, 0, std::uint64_t{1} << 40, 255, 256, 1};
+
+  RadixSort(dynamic_array.begin(), dynamic_array.end());
+  EXPECT_EQ(dynamic_array,
+            (DynamicArray<std::uint64_t>{0, 1, 255, 256, std::uint64_t{1} << 40,
+                                         UINT64_MAX}));
+}
+
+TEST(SortingTest, RadixSort_Float) {
+  Array<float, 7> array{1.5f, -0.5f, 0.0f, -100.0f, 3.0e20f, -1.0e-20f, 2.0f};
+
+  RadixSort(array.begin(), array.end());
+  EXPECT_EQ(array, (Array<float, 7>{-100.0f, -0.5f, -1.0e-20f, 0.0f, 1.5f,
+                                    2.0f, 3.0e20f}));
+
+  DynamicArray<double> dynamic_array{2.5, -2.5, 1e300, -1e-300, 0.25};
+  RadixSort(dynamic_array.begin(), dynamic_array.end());
+  EXPECT_EQ(dynamic_array,
+            (DynamicArray<double>{-2.5, -1e-300, 0.25, 2.5, 1e300}));
+}
+
+TEST(SortingTest, RadixSort_KeyFunction) {
+  DynamicArray<Record> records;
+  for (const int value : RandomArray(2000, 100)) {
+    records.PushBack({value * (std::int64_t{1} << 40), records.Size()});
+  }
+
+  RadixSort(records.begin(), records.end(),
+            [](const Record& record) { return record.key; });
+  for (std::size_t i{1}; i < records.Size(); ++i) {
+    ASSERT_LE(records[i - 1].key, records[i].key);
+    if (records[i - 1].key == records[i].key) {
+      ASSERT_LT(records[i - 1].position, records[i].position);
+    }
+  }
+}
+
+TEST(SortingTest, RadixSort_NonTrivial) {
+  DynamicArray<std::string> dynamic_array{"ccc", "a", "", "bb", "dddd"};
+
+  RadixSort(dynamic_array.begin(), dynamic_array.end(),
+            [](const std::string& value) { return value.size(); });
+  EXPECT_EQ(dynamic_array,
+            (DynamicArray<std::string>{"", "a", "bb", "ccc", "dddd"}));
+}
@@ -0,0 +1,268 @@
+#ifndef CPP_ALGORITHMS_ALLOCATORS_ARENA_ALLOCATOR_ARENA_ALLOCATOR_H_
+#define CPP_ALGORITHMS_ALLOCATORS_ARENA_ALLOCATOR_ARENA_ALLOCATOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// Region of memory handed out by bumping a pointer. Blocks are obtained from
+// malloc as the arena fills up, each twice the size of the previous one, and
+// are only given back on Release() or destruction. Reset() makes all of the
+// memory available again in one step, without returning the blocks, so an
+// arena reused across requests stops calling malloc once it has warmed up.
+class MonotonicArena {
+ public:
+  static constexpr std::size_t kDefaultBlockSize{std::size_t{1} << 16};
+
+  // Constructors
+
+  explicit MonotonicArena(
+      const std::size_t block_size = kDefaultBlockSize) noexcept
+      : next_block_size_{std::max(block_size, sizeof(Block))} {}
+
+  MonotonicArena(const MonotonicArena& other) = delete;
+
+  ~MonotonicArena() { Release(); }
+
+  // Assignments
+
+  MonotonicArena& operator=(const MonotonicArena& other) = delete;
+
+  // Allocation
+
+  void* Allocate(const std::size_t bytes, const std::size_t alignment) {
+    void* pointer{TryAllocate(bytes, alignment)};
+    while (pointer == nullptr) {
+      NextBlock(bytes, alignment);
+      pointer = TryAllocate(bytes, alignment);
+    }
+    return pointer;
+  }
+
+  // Resizes the block at `pointer`. The most recent allocation grows or
+  // shrinks in place when its block has room, anything else is copied.
+  void* Reallocate(void* const pointer, const std::size_t old_bytes,
+                   const std::size_t new_bytes, const std::size_t alignment) {
+    auto* const bytes{static_cast<unsigned char*>(pointer)};
+    if (bytes != nullptr && bytes + old_bytes == cursor_ &&
+        new_bytes <= static_cast<std::size_t>(end_ - bytes)) {
+      cursor_ = bytes + new_bytes;
+      return pointer;
+    }
+
+    void* const new_pointer{Allocate(new_bytes, alignment)};
+    if (bytes != nullptr) {
+      std::memcpy(new_pointer, pointer, std::min(old_bytes, new_bytes));
+    }
+    return new_pointer;
+  }
+
+  // Makes the whole arena available again. Everything allocated from it
+  // must no longer be in use.
+  void Reset() noexcept {
+    current_ = first_;
+    if (current_ == nullptr) return;
+    cursor_ = current_->Data();
+    end_ = current_->End();
+  }
+
+  // Resets the arena and gives its blocks back to malloc.
+  void Release() noexcept {
+    while (first_ != nullptr) {
+      Block* const next{first_->next};
+      std::free(first_);
+      first_ = next;
+    }
+
+    current_ = nullptr;
+    cursor_ = end_ = nullptr;
+  }
+
+  // Capacity
+
+  // Bytes handed out since the last reset, counting alignment padding and
+  // the unused ends of blocks that filled up.
+  std::size_t Used() const noexcept {
+    std::size_t used{0};
+    for (const Block* block{first_}; block != current_; block = block->next) {
+      used += block->size;
+    }
+    if (current_ != nullptr) {
+      used += static_cast<std::size_t>(cursor_ - current_->Data());
+    }
+    return used;
+  }
+
+  // Bytes held in blocks, used or not.
+  std::size_t Capacity() const noexcept {
+    std::size_t capacity{0};
+    for (const Block* block{first_}; block != nullptr; block = block->next) {
+      capacity += block->size;
+    }
+    return capacity;
+  }
+
+  // Lookup
+
+  // The arena that ArenaAllocator allocates from on this thread, set by
+  // ArenaScope.
+  static MonotonicArena* Current() noexcept { return current_arena_; }
+
+ private:
+  struct alignas(std::max_align_t) Block {
+    Block* next;
+    std::size_t size;
+
+    unsigned char* Data() noexcept {
+      return reinterpret_cast<unsigned char*>(this + 1);
+    }
+    unsigned char* End() noexcept { return Data() + size; }
+  };
+
+  void* TryAllocate(const std::size_t bytes,
+                    const std::size_t alignment) noexcept {
+    if (cursor_ == nullptr) return nullptr;
+
+    const auto address{reinterpret_cast<std::uintptr_t>(cursor_)};
+    const std::size_t padding{(alignment - address % alignment) % alignment};
+    if (padding + bytes > static_cast<std::size_t>(end_ - cursor_)) {
+      return nullptr;
+    }
+
+    unsigned char* const pointer{cursor_ + padding};
+    cursor_ = pointer + bytes;
+    return pointer;
+  }
+
+  // Moves to the next block kept from before the last reset, or adds a new
+  // one that fits `bytes`.
+  void NextBlock(const std::size_t bytes, const std::size_t alignment) {
+    if (bytes > SIZE_MAX / 2 - alignment) throw std::bad_alloc();
+    const std::size_t needed{bytes + alignment};
+
+    Block* block{current_ == nullptr ? first_ : current_->next};
+    if (block == nullptr || block->size < needed) {
+      const std::size_t size{std::max(next_block_size_, needed)};
+      block = static_cast<Block*>(std::malloc(sizeof(Block) + size));
+      if (block == nullptr) throw std::bad_alloc();
+
+      block->size = size;
+      block->next = current_ == nullptr ? first_ : current_->next;
+      if (current_ == nullptr) {
+        first_ = block;
+      } else {
+        current_->next = block;
+      }
+      next_block_size_ = std::max(next_block_size_, size / 2) * 2;
+    }
+
+    current_ = block;
+    cursor_ = block->Data();
+    end_ = block->End();
+  }
+
+  static inline thread_local MonotonicArena* current_arena_{nullptr};
+
+  std::size_t next_block_size_;
+  Block* first_{nullptr};
+  Block* current_{nullptr};
+  unsigned char* cursor_{nullptr};
+  unsigned char* end_{nullptr};
+
+  friend class ArenaScope;
+};
+
+// Makes `arena` the one ArenaAllocator allocates from on this thread until
+// the scope ends, when the previous one is restored.
+class ArenaScope {
+ public:
+  // Constructors
+
+  explicit ArenaScope(MonotonicArena& arena) noexcept
+      : previous_{MonotonicArena::current_arena_} {
+    MonotonicArena::current_arena_ = &arena;
+  }
+
+  ArenaScope(const ArenaScope& other) = delete;
+
+  ~ArenaScope() { MonotonicArena::current_arena_ = previous_; }
+
+  // Assignments
+
+  ArenaScope& operator=(const ArenaScope& other) = delete;
+
+ private:
+  MonotonicArena* previous_;
+};
+
+// Allocator taking memory from the current thread's MonotonicArena, for
+// containers that are built and thrown away together. Deallocation does
+// nothing: the memory comes back when the arena is reset. Containers
+// default-construct their allocators, so the arena is picked by an
+// ArenaScope rather than passed in. Allocating outside any scope throws
+// std::bad_alloc. A container may outlive the scope it was filled in, but
+// not a reset of its arena.
+template <class T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  template <class U>
+  struct rebind {
+    using other = ArenaAllocator<U>;
+  };
+
+  // Constructors
+
+  ArenaAllocator() noexcept = default;
+
+  template <class U>
+  ArenaAllocator(const ArenaAllocator<U>&) noexcept {}
+
+  // Allocation
+
+  T* allocate(const size_type count) {
+    if (count == 0) return nullptr;
+    if (count > SIZE_MAX / sizeof(T)) throw std::bad_alloc();
+    return static_cast<T*>(Arena().Allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* const, const size_type) noexcept {}
+
+  // Only use `reallocate` for trivially relocatable types, since it moves
+  // raw bytes.
+  T* reallocate(T* const pointer, const size_type old_count,
+                const size_type new_count) {
+    if (new_count == 0) return nullptr;
+    if (new_count > SIZE_MAX / sizeof(T)) throw std::bad_alloc();
+    return static_cast<T*>(Arena().Reallocate(pointer, old_count * sizeof(T),
+                                              new_count * sizeof(T),
+                                              alignof(T)));
+  }
+
+  // Comparison operators
+
+  template <class U>
+  bool operator==(const ArenaAllocator<U>&) const noexcept {
+    return true;
+  }
+
+  template <class U>
+  bool operator!=(const ArenaAllocator<U>&) const noexcept {
+    return false;
+  }
+
+ private:
+  static MonotonicArena& Arena() {
+    MonotonicArena* const arena{MonotonicArena::Current()};
+    if (arena == nullptr) throw std::bad_alloc();
+    return *arena;
+  }
+};
+
+#endif  // CPP_ALGORITHMS_ALLOCATORS_ARENA_ALLOCATOR_ARENA_ALLOCATOR_H_
@@ -0,0 +1,239 @@
+#include "arena_allocator.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+
+#include "binary_heap.h"
+#include "cow_array.h"
+#include "deque.h"
+#include "doubly_linked_list.h"
+#include "dynamic_array.h"
+#include "has_reallocate.h"
+#include "singly_linked_list.h"
+
+// Monotonic arena
+
+TEST(MonotonicArenaTest, Allocate) {
+  MonotonicArena arena{256};
+  EXPECT_EQ(arena.Capacity(), 0);
+
+  void* const first{arena.Allocate(1, 1)};
+  void* const second{arena.Allocate(sizeof(double), alignof(double))};
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % alignof(double), 0);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(arena.Used(), 16);
+
+  // Larger than a block.
+  auto* const large{static_cast<unsigned char*>(arena.Allocate(1000, 1))};
+  large[999] = 1;
+  EXPECT_GE(arena.Capacity(), 1256);
+}
+
+TEST(MonotonicArenaTest, Reallocate) {
+  MonotonicArena arena{256};
+
+  auto* const data{static_cast<int*>(arena.Allocate(4 * sizeof(int), 4))};
+  data[3] = 3;
+  EXPECT_EQ(arena.Reallocate(data, 4 * sizeof(int), 8 * sizeof(int), 4),
+            data);
+
+  arena.Allocate(1, 1);
+  auto* const moved{static_cast<int*>(
+      arena.Reallocate(data, 8 * sizeof(int), 16 * sizeof(int), 4))};
+  EXPECT_NE(moved, data);
+  EXPECT_EQ(moved[3], 3);
+}
+
+TEST(MonotonicArenaTest, Reset) {
+  MonotonicArena arena{256};
+  for (int i{0}; i < 100; ++i) {
+    arena.Allocate(64, 8);
+  }
+  const std::size_t capacity{arena.Capacity()};
+
+  arena.Reset();
+  EXPECT_EQ(arena.Used(), 0);
+  for (int i{0}; i < 100; ++i) {
+    arena.Allocate(64, 8);
+  }
+  EXPECT_EQ(arena.Capacity(), capacity);
+
+  arena.Release();
+  EXPECT_EQ(arena.Capacity(), 0);
+}
+
+TEST(MonotonicArenaTest, Current) {
+  EXPECT_EQ(MonotonicArena::Current(), nullptr);
+
+  MonotonicArena arena;
+  MonotonicArena inner_arena;
+  {
+    const ArenaScope scope{arena};
+    EXPECT_EQ(MonotonicArena::Current(), &arena);
+    {
+      const ArenaScope inner_scope{inner_arena};
+      EXPECT_EQ(MonotonicArena::Current(), &inner_arena);
+    }
+    EXPECT_EQ(MonotonicArena::Current(), &arena);
+  }
+  EXPECT_EQ(MonotonicArena::Current(), nullptr);
+}
+
+// Arena allocator
+
+TEST(ArenaAllocatorTest, Allocate) {
+  ArenaAllocator<int> allocator;
+  EXPECT_THROW(allocator.allocate(1), std::bad_alloc);
+
+  MonotonicArena arena;
+  const ArenaScope scope{arena};
+
+  EXPECT_EQ(allocator.allocate(0), nullptr);
+  int* const data{allocator.allocate(16)};
+  data[15] = 1;
+  allocator.deallocate(data, 16);
+  EXPECT_EQ(arena.Used(), 16 * sizeof(int));
+}
+
+TEST(ArenaAllocatorTest, HasReallocate) {
+  EXPECT_TRUE(has_reallocate<ArenaAllocator<int>>);
+}
+
+TEST(ArenaAllocatorTest, EqualOperator) {
+  EXPECT_TRUE(ArenaAllocator<int>{} == ArenaAllocator<char>{});
+  EXPECT_FALSE(ArenaAllocator<int>{} != ArenaAllocator<int>{});
+}
+
+// Containers
+
+TEST(ArenaAllocatorTest, DynamicArray) {
+  MonotonicArena arena;
+  const ArenaScope scope{arena};
+
+  DynamicArray<int, ArenaAllocator<int>> dynamic_array;
+  for (int i{0}; i < 10000; ++i) {
+    dynamic_array.PushBack(i);
+  }
+
+  for (int i{0}; i < 10000; ++i) {
+    ASSERT_EQ(dynamic_array[i], i);
+  }
+  // Growth extends the last allocation in place.
+  EXPECT_LT(arena.Used(), 2 * dynamic_array.Capacity() * sizeof(int));
+
+  DynamicArray<std::string, ArenaAllocator<std::string>> strings{
+      "one", std::string(64, 'x')};
+  strings.Reserve(100);
+  EXPECT_EQ(strings[0], "one");
+  EXPECT_EQ(strings[1], std::string(64, 'x'));
+}
+
+TEST(ArenaAllocatorTest, CowArray) {
+  MonotonicArena arena;
+  const ArenaScope scope{arena};
+
+  DynamicArray<int, ArenaAllocator<int>> elements{1, 2, 3};
+  const std::size_t used{arena.Used()};
+
+  // The shared buffer holding the elements comes from the arena as well.
+  CowArray<int, ArenaAllocator<int>> array{std::move(elements)};
+  EXPECT_GT(arena.Used(), used);
+
+  const CowArray<int, ArenaAllocator<int>> copy{array};
+  array.PushBack(4);
+  EXPECT_EQ(copy.Size(), 3);
+  EXPECT_EQ(array.Size(), 4);
+  EXPECT_EQ(array[3], 4);
+}
+
+TEST(ArenaAllocatorTest, Deque) {
+  MonotonicArena arena;
+  const ArenaScope scope{arena};
+
+  Deque<int, ArenaAllocator<int>> deque;
+
+  // The first push takes a one-entry block map and one block of four ints,
+  // both from the arena.
+  deque.PushBack(0);
+  EXPECT_EQ(arena.Used(), sizeof(int*) + 4 * sizeof(int));
+
+  for (int i{1}; i < 1000; ++i) {
+    deque.PushBack(i);
+    deque.PushFront(-i);
+  }
+
+  EXPECT_EQ(deque.Size(), 1999);
+  EXPECT_EQ(deque.Front(), -999);
+  EXPECT_EQ(deque.Back(), 999);
+}
+
+TEST(ArenaAllocatorTest, SinglyLinkedList) {
+  MonotonicArena arena;
+  const ArenaScope scope{arena};
+
+  SinglyLinkedList<int, ArenaAllocator<int>> list;
+  for (int i{0}; i < 100; ++i) {
+    list.PushFront(i);
+  }
+  const std::size_t used{arena.Used()};
+
+  const SinglyLinkedList<int, ArenaAllocator<int>> copy{list};
+  EXPECT_EQ(copy, list);
+  EXPECT_GT(arena.Used(), used);
+
+  list.PopFront();
+  EXPECT_EQ(list.Front(), 98);
+}
+
+TEST(ArenaAllocatorTest, DoublyLinkedList) {
+  MonotonicArena arena;
+  const ArenaScope scope{arena};
+
+  DoublyLinkedList<std::string, ArenaAllocator<std::string>> list;
+  for (int i{0}; i < 100; ++i) {
+    list.PushBack(std::to_string(i));
+  }
+  const std::size_t used{arena.Used()};
+
+  list.Erase(list.cbegin());
+  EXPECT_EQ(list.Front(), "1");
+  EXPECT_EQ(list.Back(), "99");
+  EXPECT_EQ(arena.Used(), used);
+}
+
+TEST(ArenaAllocatorTest, BinaryHeap) {
+  MonotonicArena arena;
+  const ArenaScope scope{arena};
+
+  BinaryHeap<int, std::less<int>, ArenaAllocator<int>> heap;
+  for (int i{0}; i < 1000; ++i) {
+    heap.Insert((i * 7919) % 1000);
+  }
+
+  EXPECT_EQ(heap.Top(), 999);
+  heap.Pop();
+  EXPECT_EQ(heap.Top(), 998);
+}
+
+TEST(ArenaAllocatorTest, Reset) {
+  MonotonicArena arena;
+  for (int request{0}; request < 3; ++request) {
+    {
+      const ArenaScope scope{arena};
+      DoublyLinkedList<int, ArenaAllocator<int>> list{1, 2, 3};
+      DynamicArray<int, ArenaAllocator<int>> dynamic_array{list.Front()};
+      EXPECT_EQ(dynamic_array[0], 1);
+    }
+    arena.Reset();
+  }
+
+  EXPECT_EQ(arena.Used(), 0);
+  EXPECT_EQ(arena.Capacity(), MonotonicArena::kDefaultBlockSize);
+}
@@ -0,0 +1,176 @@
+#ifndef CPP_ALGORITHMS_ALLOCATORS_HUGE_PAGE_ALLOCATOR_HUGE_PAGE_ALLOCATOR_H_
+#define CPP_ALGORITHMS_ALLOCATORS_HUGE_PAGE_ALLOCATOR_HUGE_PAGE_ALLOCATOR_H_
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// How large blocks get their huge pages. Transparent huge pages are backed by
+// the kernel on a best-effort basis. Explicit pages come from the pool
+// reserved in /proc/sys/vm/nr_hugepages and fall back to transparent ones
+// when the pool is empty.
+enum class HugePages { kTransparent, kExplicit };
+
+// Allocations of any NUMA node.
+constexpr int kAnyNumaNode{-1};
+
+// Allocator that serves blocks of at least `HugePageThreshold` bytes from
+// anonymous mappings aligned to and sized in 2 MiB huge pages, so that
+// random access over large buffers needs far fewer TLB entries. Smaller
+// blocks come from malloc. With `NumaNode` set, the pages of large blocks
+// are bound to that node with mbind before they are first touched. Binding
+// is best effort: where the kernel does not support it the block is still
+// returned, with the default placement.
+template <class T, HugePages Pages = HugePages::kTransparent,
+          int NumaNode = kAnyNumaNode,
+          std::size_t HugePageThreshold = std::size_t{1} << 21>
+class HugePageAllocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  template <class U>
+  struct rebind {
+    using other = HugePageAllocator<U, Pages, NumaNode, HugePageThreshold>;
+  };
+
+  static constexpr std::size_t kHugePageSize{std::size_t{1} << 21};
+
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "over-aligned types are not supported");
+
+  // Constructors
+
+  HugePageAllocator() noexcept = default;
+
+  template <class U>
+  HugePageAllocator(
+      const HugePageAllocator<U, Pages, NumaNode, HugePageThreshold>&) noexcept {
+  }
+
+  // Allocation
+
+  T* allocate(const size_type count) {
+    if (count == 0) return nullptr;
+    if (count > SIZE_MAX / sizeof(T)) throw std::bad_alloc();
+
+    const std::size_t bytes{count * sizeof(T)};
+    if (!IsMapped(bytes)) return MallocBlock(bytes);
+    return MapBlock(MappedSize(bytes));
+  }
+
+  void deallocate(T* const pointer, const size_type count) noexcept {
+    if (pointer == nullptr) return;
+
+    const std::size_t bytes{count * sizeof(T)};
+    if (IsMapped(bytes)) {
+      munmap(pointer, MappedSize(bytes));
+    } else {
+      std::free(pointer);
+    }
+  }
+
+  // Comparison operators
+
+  template <class U>
+  bool operator==(const HugePageAllocator<U, Pages, NumaNode,
+                                          HugePageThreshold>&) const noexcept {
+    return true;
+  }
+
+  template <class U>
+  bool operator!=(const HugePageAllocator<U, Pages, NumaNode,
+                                          HugePageThreshold>&) const noexcept {
+    return false;
+  }
+
+ private:
+  static bool IsMapped(const std::size_t bytes) noexcept {
+    return bytes >= HugePageThreshold;
+  }
+
+  static std::size_t MappedSize(const std::size_t bytes) noexcept {
+    return (bytes + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+  }
+
+  static T* MallocBlock(const std::size_t bytes) {
+    void* const pointer{std::malloc(bytes)};
+    if (pointer == nullptr) throw std::bad_alloc();
+    return static_cast<T*>(pointer);
+  }
+
+  static T* MapBlock(const std::size_t size) {
+    void* pointer{nullptr};
+    if constexpr (Pages == HugePages::kExplicit) pointer = MapExplicit(size);
+    if (pointer == nullptr) pointer = MapTransparent(size);
+
+    BindToNode(pointer, size);
+    return static_cast<T*>(pointer);
+  }
+
+  // Maps `size` bytes of reserved huge pages, or returns null when there are
+  // not enough of them.
+  static void* MapExplicit(const std::size_t size) noexcept {
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+    void* const pointer{mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                                 (21 << MAP_HUGE_SHIFT),
+                             -1, 0)};
+    return pointer == MAP_FAILED ? nullptr : pointer;
+#else
+    static_cast<void>(size);
+    return nullptr;
+#endif
+  }
+
+  // Maps `size` bytes at a huge page boundary, which the kernel needs to back
+  // the range with huge pages, by over-mapping and trimming both ends.
+  static void* MapTransparent(const std::size_t size) {
+    const std::size_t padded_size{size + kHugePageSize};
+    void* const mapping{mmap(nullptr, padded_size, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+    if (mapping == MAP_FAILED) throw std::bad_alloc();
+
+    const auto address{reinterpret_cast<std::uintptr_t>(mapping)};
+    const std::uintptr_t aligned{(address + kHugePageSize - 1) &
+                                 ~std::uintptr_t{kHugePageSize - 1}};
+    const std::size_t head{aligned - address};
+    const std::size_t tail{padded_size - head - size};
+    if (head != 0) munmap(mapping, head);
+    if (tail != 0) munmap(reinterpret_cast<void*>(aligned + size), tail);
+
+    void* const pointer{reinterpret_cast<void*>(aligned)};
+#ifdef MADV_HUGEPAGE
+    madvise(pointer, size, MADV_HUGEPAGE);
+#endif
+    return pointer;
+  }
+
+  static void BindToNode(void* const pointer, const std::size_t size) noexcept {
+    if constexpr (NumaNode == kAnyNumaNode) {
+      static_cast<void>(pointer);
+      static_cast<void>(size);
+    } else {
+#ifdef SYS_mbind
+      static_assert(NumaNode >= 0 && NumaNode < 64,
+                    "the node mask holds nodes 0 to 63");
+
+      constexpr int kBindPolicy{2};  // MPOL_BIND
+      const unsigned long node_mask{1UL << NumaNode};
+      syscall(SYS_mbind, pointer, size, kBindPolicy, &node_mask,
+              sizeof(node_mask) * 8, 0);
+#else
+      static_cast<void>(pointer);
+      static_cast<void>(size);
+#endif
+    }
+  }
+};
+
+#endif  // CPP_ALGORITHMS_ALLOCATORS_HUGE_PAGE_ALLOCATOR_HUGE_PAGE_ALLOCATOR_H_
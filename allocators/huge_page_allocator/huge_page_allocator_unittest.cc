@@ -0,0 +1,143 @@
+#include "huge_page_allocator.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "binary_heap.h"
+#include "deque.h"
+#include "dynamic_array.h"
+
+constexpr std::size_t kThreshold{1 << 16};
+constexpr std::size_t kLargeCount{kThreshold / sizeof(int)};
+
+using TestAllocator =
+    HugePageAllocator<int, HugePages::kTransparent, kAnyNumaNode, kThreshold>;
+
+bool IsHugePageAligned(const void* const pointer) {
+  return reinterpret_cast<std::uintptr_t>(pointer) %
+             TestAllocator::kHugePageSize ==
+         0;
+}
+
+// Allocation
+
+TEST(HugePageAllocatorTest, Allocate) {
+  TestAllocator allocator;
+  EXPECT_EQ(allocator.allocate(0), nullptr);
+
+  for (const std::size_t count : {std::size_t{16}, kLargeCount * 4}) {
+    int* const data{allocator.allocate(count)};
+    ASSERT_NE(data, nullptr);
+    data[0] = 1;
+    data[count - 1] = 2;
+    EXPECT_EQ(data[0] + data[count - 1], 3);
+    allocator.deallocate(data, count);
+  }
+
+  allocator.deallocate(nullptr, 0);
+}
+
+TEST(HugePageAllocatorTest, Allocate_Aligned) {
+  TestAllocator allocator;
+
+  for (const std::size_t count :
+       {kLargeCount, kLargeCount * 33, kLargeCount * 100}) {
+    int* const data{allocator.allocate(count)};
+    EXPECT_TRUE(IsHugePageAligned(data));
+    for (std::size_t i{0}; i < count; ++i) {
+      data[i] = static_cast<int>(i);
+    }
+    EXPECT_EQ(data[count - 1], static_cast<int>(count - 1));
+    allocator.deallocate(data, count);
+  }
+}
+
+TEST(HugePageAllocatorTest, Allocate_Explicit) {
+  // Falls back to transparent huge pages when none are reserved.
+  HugePageAllocator<int, HugePages::kExplicit, kAnyNumaNode, kThreshold>
+      allocator;
+
+  int* const data{allocator.allocate(kLargeCount * 64)};
+  EXPECT_TRUE(IsHugePageAligned(data));
+  data[kLargeCount * 64 - 1] = 1;
+  allocator.deallocate(data, kLargeCount * 64);
+}
+
+TEST(HugePageAllocatorTest, Allocate_NumaNode) {
+  HugePageAllocator<int, HugePages::kTransparent, 0, kThreshold> allocator;
+
+  int* const data{allocator.allocate(kLargeCount * 64)};
+  EXPECT_TRUE(IsHugePageAligned(data));
+  data[0] = 1;
+  data[kLargeCount * 64 - 1] = 2;
+  EXPECT_EQ(data[0] + data[kLargeCount * 64 - 1], 3);
+  allocator.deallocate(data, kLargeCount * 64);
+}
+
+// Comparison operators
+
+TEST(HugePageAllocatorTest, EqualOperator) {
+  EXPECT_TRUE((TestAllocator{} ==
+               HugePageAllocator<char, HugePages::kTransparent, kAnyNumaNode,
+                                 kThreshold>{}));
+  EXPECT_FALSE(TestAllocator{} != TestAllocator{});
+}
+
+// Containers
+
+TEST(HugePageAllocatorTest, DynamicArray_PushBack) {
+  DynamicArray<int, TestAllocator> dynamic_array;
+  for (std::size_t i{0}; i < kLargeCount * 16; ++i) {
+    dynamic_array.PushBack(static_cast<int>(i));
+  }
+
+  EXPECT_TRUE(IsHugePageAligned(dynamic_array.Data()));
+  for (std::size_t i{0}; i < dynamic_array.Size(); ++i) {
+    ASSERT_EQ(dynamic_array[i], static_cast<int>(i));
+  }
+
+  dynamic_array.Erase(dynamic_array.cbegin() + 16, dynamic_array.cend());
+  dynamic_array.ShrinkToFit();
+  EXPECT_EQ(dynamic_array.Capacity(), 16);
+  EXPECT_EQ(dynamic_array.Back(), 15);
+}
+
+TEST(HugePageAllocatorTest, DynamicArray_NonTrivial) {
+  const std::string long_string(64, 'x');
+  DynamicArray<std::string,
+               HugePageAllocator<std::string, HugePages::kTransparent,
+                                 kAnyNumaNode, kThreshold>>
+      dynamic_array{"one", long_string};
+
+  dynamic_array.Reserve(kThreshold);
+  EXPECT_EQ(dynamic_array[0], "one");
+  EXPECT_EQ(dynamic_array[1], long_string);
+}
+
+TEST(HugePageAllocatorTest, Deque) {
+  Deque<int, HugePageAllocator<int, HugePages::kTransparent, kAnyNumaNode,
+                               sizeof(int)>>
+      deque;
+  for (int i{0}; i < 1000; ++i) {
+    deque.PushBack(i);
+    deque.PushFront(-i);
+  }
+
+  EXPECT_EQ(deque.Size(), 2000);
+  EXPECT_EQ(deque.Front(), -999);
+  EXPECT_EQ(deque.Back(), 999);
+}
+
+TEST(HugePageAllocatorTest, BinaryHeap) {
+  BinaryHeap<int, std::less<int>, TestAllocator> heap;
+  for (std::size_t i{0}; i < kLargeCount * 4; ++i) {
+    heap.Insert(static_cast<int>((i * 7919) % (kLargeCount * 4)));
+  }
+
+  EXPECT_EQ(heap.Top(), static_cast<int>(kLargeCount * 4 - 1));
+  heap.Pop();
+  EXPECT_EQ(heap.Top(), static_cast<int>(kLargeCount * 4 - 2));
+}
@@ -0,0 +1,137 @@
+#ifndef CPP_ALGORITHMS_ALLOCATORS_MMAP_ALLOCATOR_MMAP_ALLOCATOR_H_
+#define CPP_ALGORITHMS_ALLOCATORS_MMAP_ALLOCATOR_MMAP_ALLOCATOR_H_
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// Allocator that serves blocks of at least `MmapThreshold` bytes straight
+// from anonymous memory mappings and smaller ones from malloc. Its
+// `reallocate` grows large blocks by remapping their pages (mremap on Linux),
+// so they are neither copied nor briefly held twice. Only use `reallocate`
+// for trivially relocatable types, since it moves raw bytes.
+template <class T, std::size_t MmapThreshold = 1 << 20>
+class MmapAllocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  template <class U>
+  struct rebind {
+    using other = MmapAllocator<U, MmapThreshold>;
+  };
+
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "over-aligned types are not supported");
+
+  // Constructors
+
+  MmapAllocator() noexcept = default;
+
+  template <class U>
+  MmapAllocator(const MmapAllocator<U, MmapThreshold>&) noexcept {}
+
+  // Allocation
+
+  T* allocate(const size_type count) {
+    if (count == 0) return nullptr;
+    if (count > SIZE_MAX / sizeof(T)) throw std::bad_alloc();
+
+    const std::size_t bytes{count * sizeof(T)};
+    if (!IsMapped(bytes)) return MallocBlock(bytes);
+    return MapBlock(MappedSize(bytes));
+  }
+
+  void deallocate(T* const pointer, const size_type count) noexcept {
+    if (pointer == nullptr) return;
+
+    const std::size_t bytes{count * sizeof(T)};
+    if (IsMapped(bytes)) {
+      munmap(pointer, MappedSize(bytes));
+    } else {
+      std::free(pointer);
+    }
+  }
+
+  T* reallocate(T* const pointer, const size_type old_count,
+                const size_type new_count) {
+    if (pointer == nullptr) return allocate(new_count);
+    if (new_count == 0) {
+      deallocate(pointer, old_count);
+      return nullptr;
+    }
+    if (new_count > SIZE_MAX / sizeof(T)) throw std::bad_alloc();
+
+    const std::size_t old_bytes{old_count * sizeof(T)};
+    const std::size_t new_bytes{new_count * sizeof(T)};
+
+    if (!IsMapped(old_bytes) && !IsMapped(new_bytes)) {
+      void* const new_pointer{std::realloc(pointer, new_bytes)};
+      if (new_pointer == nullptr) throw std::bad_alloc();
+      return static_cast<T*>(new_pointer);
+    }
+
+    if (IsMapped(old_bytes) && IsMapped(new_bytes)) {
+      const std::size_t old_size{MappedSize(old_bytes)};
+      const std::size_t new_size{MappedSize(new_bytes)};
+      if (old_size == new_size) return pointer;
+#ifdef __linux__
+      void* const new_pointer{
+          mremap(pointer, old_size, new_size, MREMAP_MAYMOVE)};
+      if (new_pointer == MAP_FAILED) throw std::bad_alloc();
+      return static_cast<T*>(new_pointer);
+#endif
+    }
+
+    T* const new_pointer{allocate(new_count)};
+    std::memcpy(static_cast<void*>(new_pointer), static_cast<void*>(pointer),
+                std::min(old_bytes, new_bytes));
+    deallocate(pointer, old_count);
+    return new_pointer;
+  }
+
+  // Comparison operators
+
+  template <class U>
+  bool operator==(const MmapAllocator<U, MmapThreshold>&) const noexcept {
+    return true;
+  }
+
+  template <class U>
+  bool operator!=(const MmapAllocator<U, MmapThreshold>&) const noexcept {
+    return false;
+  }
+
+ private:
+  static bool IsMapped(const std::size_t bytes) noexcept {
+    return bytes >= MmapThreshold;
+  }
+
+  static std::size_t MappedSize(const std::size_t bytes) noexcept {
+    static const std::size_t page_size{
+        static_cast<std::size_t>(sysconf(_SC_PAGESIZE))};
+    return (bytes + page_size - 1) / page_size * page_size;
+  }
+
+  static T* MallocBlock(const std::size_t bytes) {
+    void* const pointer{std::malloc(bytes)};
+    if (pointer == nullptr) throw std::bad_alloc();
+    return static_cast<T*>(pointer);
+  }
+
+  static T* MapBlock(const std::size_t size) {
+    void* const pointer{mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+    if (pointer == MAP_FAILED) throw std::bad_alloc();
+    return static_cast<T*>(pointer);
+  }
+};
+
+#endif  // CPP_ALGORITHMS_ALLOCATORS_MMAP_ALLOCATOR_MMAP_ALLOCATOR_H_
@@ -0,0 +1,112 @@
+#include "mmap_allocator.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "dynamic_array.h"
+#include "has_reallocate.h"
+
+constexpr std::size_t kThreshold{1 << 16};
+constexpr std::size_t kLargeCount{kThreshold / sizeof(int)};
+
+using TestAllocator = MmapAllocator<int, kThreshold>;
+
+// Allocation
+
+TEST(MmapAllocatorTest, Allocate) {
+  TestAllocator allocator;
+  EXPECT_EQ(allocator.allocate(0), nullptr);
+
+  for (const std::size_t count : {std::size_t{16}, kLargeCount * 4}) {
+    int* const data{allocator.allocate(count)};
+    ASSERT_NE(data, nullptr);
+    data[0] = 1;
+    data[count - 1] = 2;
+    EXPECT_EQ(data[0] + data[count - 1], 3);
+    allocator.deallocate(data, count);
+  }
+
+  allocator.deallocate(nullptr, 0);
+}
+
+TEST(MmapAllocatorTest, Reallocate) {
+  TestAllocator allocator;
+
+  std::size_t count{16};
+  int* data{allocator.reallocate(nullptr, 0, count)};
+  for (std::size_t i{0}; i < count; ++i) {
+    data[i] = static_cast<int>(i);
+  }
+
+  // Small to small, small to mapped, mapped to mapped, and back down.
+  for (const std::size_t new_count :
+       {std::size_t{64}, kLargeCount * 2, kLargeCount * 64, kLargeCount * 3,
+        std::size_t{32}}) {
+    data = allocator.reallocate(data, count, new_count);
+    ASSERT_NE(data, nullptr);
+    for (std::size_t i{0}; i < std::min(count, new_count); ++i) {
+      ASSERT_EQ(data[i], static_cast<int>(i));
+    }
+    for (std::size_t i{count}; i < new_count; ++i) {
+      data[i] = static_cast<int>(i);
+    }
+    count = new_count;
+  }
+
+  EXPECT_EQ(allocator.reallocate(data, count, 0), nullptr);
+}
+
+TEST(MmapAllocatorTest, HasReallocate) {
+  EXPECT_TRUE(has_reallocate<TestAllocator>);
+  EXPECT_FALSE(has_reallocate<std::allocator<int>>);
+}
+
+// Comparison operators
+
+TEST(MmapAllocatorTest, EqualOperator) {
+  EXPECT_TRUE((TestAllocator{} == MmapAllocator<char, kThreshold>{}));
+  EXPECT_FALSE(TestAllocator{} != TestAllocator{});
+}
+
+// Dynamic array
+
+TEST(MmapAllocatorTest, DynamicArray_PushBack) {
+  DynamicArray<int, TestAllocator> dynamic_array;
+  for (std::size_t i{0}; i < kLargeCount * 16; ++i) {
+    dynamic_array.PushBack(static_cast<int>(i));
+  }
+
+  for (std::size_t i{0}; i < dynamic_array.Size(); ++i) {
+    ASSERT_EQ(dynamic_array[i], static_cast<int>(i));
+  }
+
+  dynamic_array.Erase(dynamic_array.cbegin() + 16, dynamic_array.cend());
+  dynamic_array.ShrinkToFit();
+  EXPECT_EQ(dynamic_array.Capacity(), 16);
+  EXPECT_EQ(dynamic_array.Back(), 15);
+}
+
+TEST(MmapAllocatorTest, DynamicArray_Insert) {
+  DynamicArray<int, TestAllocator> dynamic_array{1, 4};
+
+  dynamic_array.Insert(dynamic_array.cbegin() + 1, {2, 3});
+  dynamic_array.Insert(dynamic_array.cbegin(), kLargeCount, dynamic_array[3]);
+  EXPECT_EQ(dynamic_array.Size(), kLargeCount + 4);
+  EXPECT_EQ(dynamic_array.Front(), 4);
+  EXPECT_EQ(dynamic_array[kLargeCount], 1);
+  EXPECT_EQ(dynamic_array[kLargeCount + 2], 3);
+}
+
+TEST(MmapAllocatorTest, DynamicArray_NonTrivial) {
+  const std::string long_string(64, 'x');
+  DynamicArray<std::string, MmapAllocator<std::string, kThreshold>>
+      dynamic_array{"one", long_string};
+
+  dynamic_array.Reserve(kThreshold);
+  EXPECT_EQ(dynamic_array[0], "one");
+  EXPECT_EQ(dynamic_array[1], long_string);
+}
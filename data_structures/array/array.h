@@ -8,6 +8,8 @@
 #include <stdexcept>
 #include <utility>
 
+#include "simd.h"
+
 template <class T, std::size_t N>
 class Array {
  private:
@@ -307,11 +309,7 @@ class Array {
 
   // Operations
 
-  void Fill(const_reference value) {
-    for (std::size_t i{0}; i < N; ++i) {
-      (*this)[i] = value;
-    }
-  }
+  void Fill(const_reference value) { SimdFill(data_, N, value); }
 
   void Swap(Array& other) noexcept {
     for (std::size_t i{0}; i < N; ++i) {
@@ -319,13 +317,23 @@ class Array {
     }
   }
 
+  // Lookup
+
+  iterator Find(const_reference value) {
+    return iterator(data_, SimdFind(data_, N, value));
+  }
+  const_iterator Find(const_reference value) const {
+    return const_iterator(data_, SimdFind(data_, N, value));
+  }
+
+  size_type Count(const_reference value) const {
+    return SimdCount(data_, N, value);
+  }
+
   // Comparison operators
 
   bool operator==(const Array& other) const noexcept {
-    for (std::size_t i{0}; i < N; ++i) {
-      if ((*this)[i] != other[i]) return false;
-    }
-    return true;
+    return SimdEqual(data_, other.data_, N);
   }
 
   bool operator!=(const Array& other) const noexcept {
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstdint>
 #include <stdexcept>
 
 // Constructors
@@ -279,6 +281,17 @@ TEST(ArrayTest, Fill) {
   EXPECT_EQ(array, (Array<int, 3>{5, 5, 5}));
 }
 
+TEST(ArrayTest, Fill_Vectorized) {
+  Array<std::uint8_t, 37> bytes;
+  bytes.Fill(0xAB);
+  EXPECT_EQ(bytes.Count(0xAB), 37);
+
+  Array<double, 9> doubles;
+  doubles.Fill(-0.5);
+  EXPECT_EQ(doubles.Back(), -0.5);
+  EXPECT_EQ(doubles.Count(-0.5), 9);
+}
+
 TEST(ArrayTest, Swap) {
   Array<int, 3> a{1, 2, 3};
   Array<int, 3> b{4, 5, 6};
@@ -290,6 +303,33 @@ TEST(ArrayTest, Swap) {
   EXPECT_EQ(b, expected_b);
 }
 
+// Lookup
+
+TEST(ArrayTest, Find) {
+  Array<std::int16_t, 20> array;
+  for (std::size_t i{0}; i < array.Size(); ++i) {
+    array[i] = static_cast<std::int16_t>(i % 10);
+  }
+
+  EXPECT_EQ(array.Find(7) - array.begin(), 7);
+  EXPECT_EQ(array.Find(10), array.end());
+
+  *array.Find(7) = 10;
+  EXPECT_EQ(std::as_const(array).Find(10) - array.cbegin(), 7);
+  EXPECT_EQ(std::as_const(array).Find(7) - array.cbegin(), 17);
+}
+
+TEST(ArrayTest, Count) {
+  Array<int, 33> array;
+  for (std::size_t i{0}; i < array.Size(); ++i) {
+    array[i] = static_cast<int>(i % 3);
+  }
+
+  EXPECT_EQ(array.Count(0), 11);
+  EXPECT_EQ(array.Count(2), 11);
+  EXPECT_EQ(array.Count(3), 0);
+}
+
 // Comparison operators
 
 TEST(ArrayTest, EqualOperator) {
@@ -298,6 +338,25 @@ TEST(ArrayTest, EqualOperator) {
   EXPECT_EQ(a, b);
 }
 
+TEST(ArrayTest, EqualOperator_Vectorized) {
+  Array<std::int64_t, 11> a;
+  a.Fill(1);
+  for (std::size_t i{0}; i < a.Size(); ++i) {
+    Array<std::int64_t, 11> b{a};
+    b[i] = std::int64_t{1} << 32 | 1;
+    EXPECT_NE(a, b) << i;
+  }
+
+  Array<float, 8> floats;
+  floats.Fill(0.0f);
+  Array<float, 8> negative_zeros;
+  negative_zeros.Fill(-0.0f);
+  EXPECT_EQ(floats, negative_zeros);
+
+  floats[5] = std::nanf("");
+  EXPECT_NE(floats, floats);
+}
+
 TEST(ArrayTest, NotEqualOperator) {
   constexpr Array<int, 3> a{1, 2, 3};
   constexpr Array<int, 3> b{4, 5, 6};
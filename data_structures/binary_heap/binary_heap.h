@@ -8,10 +8,12 @@
 #include <utility>
 
 #include "dynamic_array.h"
+#include "growth_policy.h"
 #include "is_iterator.h"
 
 template <class T, class Compare = std::less<T>,
-          class Allocator = std::allocator<T>>
+          class Allocator = std::allocator<T>,
+          class GrowthPolicy = DoublingGrowth>
 class BinaryHeap {
  public:
   using value_compare = Compare;
@@ -22,7 +24,8 @@ class BinaryHeap {
   using const_reference = const value_type&;
   using pointer = value_type*;
   using const_pointer = const value_type*;
-  using const_iterator = typename DynamicArray<T, Allocator>::const_iterator;
+  using const_iterator =
+      typename DynamicArray<T, Allocator, GrowthPolicy>::const_iterator;
 
   // Constructors
 
@@ -89,7 +92,21 @@ class BinaryHeap {
 
   void Clear() noexcept { array_.Clear(); }
 
-  void Insert(const_reference value) { Insert({value}); }
+  void Insert(const_reference value) {
+    array_.PushBack(value);
+    SiftUp(Size() - 1);
+  }
+
+  void Insert(T&& value) {
+    array_.PushBack(std::move(value));
+    SiftUp(Size() - 1);
+  }
+
+  template <class... Args>
+  void Emplace(Args&&... args) {
+    array_.EmplaceBack(std::forward<Args>(args)...);
+    SiftUp(Size() - 1);
+  }
 
   template <class InputIterator,
             std::enable_if_t<is_iterator<InputIterator>, bool> = true>
@@ -160,6 +177,16 @@ class BinaryHeap {
     }
   }
 
+  void SiftUp(std::size_t index) {
+    while (index > 0) {
+      const std::size_t parent{(index - 1) / 2};
+      if (!Compare{}(array_[parent], array_[index])) return;
+
+      std::swap(array_[parent], array_[index]);
+      index = parent;
+    }
+  }
+
   void Heapify(const std::size_t index) {
     const std::size_t left{2 * index + 1};
     const std::size_t right{2 * index + 2};
@@ -179,7 +206,7 @@ class BinaryHeap {
     }
   }
 
-  DynamicArray<T, Allocator> array_;
+  DynamicArray<T, Allocator, GrowthPolicy> array_;
 };
 
 #endif  // CPP_ALGORITHMS_DATA_STRUCTURES_BINARY_HEAP_BINARY_HEAP_H_
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 #include <functional>
 #include <initializer_list>
+#include <memory>
+#include <string>
 #include <utility>
 
 template <class T>
@@ -185,6 +187,16 @@ TEST(BinaryHeapTest, Capacity) {
   EXPECT_EQ(binary_heap.Capacity(), 4);
 }
 
+TEST(BinaryHeapTest, Capacity_GrowthPolicy) {
+  BinaryHeap<int, std::less<int>, std::allocator<int>, OneAndHalfGrowth>
+      binary_heap{1, 2, 3, 4};
+  EXPECT_EQ(binary_heap.Capacity(), 4);
+
+  binary_heap.Insert(5);
+  EXPECT_EQ(binary_heap.Capacity(), 6);
+  EXPECT_EQ(binary_heap.Top(), 5);
+}
+
 TEST(BinaryHeapTest, ShrinkToFit) {
   MaxBinaryHeap<int> binary_heap;
   binary_heap.Reserve(10);
@@ -228,6 +240,26 @@ TEST(BinaryHeapTest, Insert_Value) {
   EXPECT_EQ(binary_heap.Top(), 3);
 }
 
+TEST(BinaryHeapTest, Insert_Rvalue) {
+  MaxBinaryHeap<std::string> binary_heap;
+
+  std::string value(32, 'a');
+  binary_heap.Insert(std::move(value));
+  binary_heap.Insert(std::string(32, 'c'));
+  binary_heap.Insert(std::string(32, 'b'));
+  EXPECT_EQ(binary_heap.Size(), 3);
+  EXPECT_EQ(binary_heap.Top(), std::string(32, 'c'));
+}
+
+TEST(BinaryHeapTest, Emplace) {
+  MinBinaryHeap<std::string> binary_heap;
+
+  binary_heap.Emplace(3, 'b');
+  binary_heap.Emplace(2, 'a');
+  binary_heap.Emplace("c");
+  EXPECT_EQ(binary_heap.Top(), "aa");
+}
+
 TEST(BinaryHeapTest, Insert_Range) {
   const std::initializer_list<int> source{3, 2, 1, 7, 9, 8, 4, 5, 6};
   MaxBinaryHeap<int> binary_heap;
@@ -0,0 +1,373 @@
+#ifndef CPP_ALGORITHMS_DATA_STRUCTURES_COMPACT_ORDERED_MAP_COMPACT_ORDERED_MAP_H_
+#define CPP_ALGORITHMS_DATA_STRUCTURES_COMPACT_ORDERED_MAP_COMPACT_ORDERED_MAP_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "dynamic_array.h"
+#include "is_iterator.h"
+
+// Hash map that keeps its entries densely in insertion order. Lookups go
+// through a separate open-addressing index of 32-bit entry positions, so
+// iteration only touches the entry array. Erase preserves the order of the
+// remaining entries and is therefore linear in the size of the map.
+template <class Key, class T, class Hash = std::hash<Key>>
+class CompactOrderedMap {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = typename DynamicArray<value_type>::iterator;
+  using const_iterator = typename DynamicArray<value_type>::const_iterator;
+  using reverse_iterator = typename DynamicArray<value_type>::reverse_iterator;
+  using const_reverse_iterator =
+      typename DynamicArray<value_type>::const_reverse_iterator;
+
+  // Constructors
+
+  CompactOrderedMap() noexcept = default;
+
+  CompactOrderedMap(const CompactOrderedMap& other)
+      : entries_{other.entries_},
+        index_{other.index_},
+        erased_{other.erased_},
+        max_load_factor_{other.max_load_factor_} {}
+
+  CompactOrderedMap(CompactOrderedMap&& other) noexcept { Swap(other); }
+
+  CompactOrderedMap(const std::initializer_list<value_type> list) {
+    Insert(list);
+  }
+
+  // Assignments
+
+  CompactOrderedMap& operator=(const CompactOrderedMap& other) {
+    if (this == &other) return *this;
+
+    entries_ = other.entries_;
+    index_ = other.index_;
+    erased_ = other.erased_;
+    max_load_factor_ = other.max_load_factor_;
+
+    return *this;
+  }
+
+  CompactOrderedMap& operator=(CompactOrderedMap&& other) noexcept {
+    if (this == &other) return *this;
+
+    Clear();
+    Swap(other);
+
+    return *this;
+  }
+
+  CompactOrderedMap& operator=(const std::initializer_list<value_type> list) {
+    Clear();
+    Insert(list);
+    return *this;
+  }
+
+  // Iterators
+
+  iterator begin() noexcept { return entries_.begin(); }
+  const_iterator begin() const noexcept { return entries_.begin(); }
+  const_iterator cbegin() const noexcept { return entries_.cbegin(); }
+
+  iterator end() noexcept { return entries_.end(); }
+  const_iterator end() const noexcept { return entries_.end(); }
+  const_iterator cend() const noexcept { return entries_.cend(); }
+
+  reverse_iterator rbegin() noexcept { return entries_.rbegin(); }
+  const_reverse_iterator rbegin() const noexcept { return entries_.rbegin(); }
+  const_reverse_iterator crbegin() const noexcept { return entries_.crbegin(); }
+
+  reverse_iterator rend() noexcept { return entries_.rend(); }
+  const_reverse_iterator rend() const noexcept { return entries_.rend(); }
+  const_reverse_iterator crend() const noexcept { return entries_.crend(); }
+
+  // Capacity
+
+  bool Empty() const noexcept { return entries_.Empty(); }
+
+  size_type Size() const noexcept { return entries_.Size(); }
+
+  size_type Capacity() const noexcept { return entries_.Capacity(); }
+
+  void ShrinkToFit() {
+    entries_.ShrinkToFit();
+    Rehash(0);
+  }
+
+  // Modifiers
+
+  void Clear() noexcept {
+    entries_.Clear();
+    for (std::uint32_t& slot : index_) {
+      slot = kEmptySlot;
+    }
+    erased_ = 0;
+  }
+
+  std::pair<iterator, bool> Insert(const value_type& value) {
+    const std::size_t hash{Hash{}(value.first)};
+    if (const std::size_t slot{FindSlot(value.first, hash)}; slot != kNotFound)
+      return {begin() + index_[slot], false};
+
+    CheckRehash(1);
+    return {InsertUnchecked(value, hash), true};
+  }
+
+  template <class InputIterator,
+            std::enable_if_t<is_iterator<InputIterator>, bool> = false>
+  void Insert(const InputIterator first, const InputIterator last) {
+    if (first == last) return;
+
+    const std::size_t distance{
+        static_cast<std::size_t>(std::distance(first, last))};
+    CheckRehash(distance);
+    entries_.Reserve(Size() + distance);
+
+    for (InputIterator it{first}; it != last; ++it) {
+      const std::size_t hash{Hash{}(it->first)};
+      if (FindSlot(it->first, hash) != kNotFound) continue;
+      InsertUnchecked(*it, hash);
+    }
+  }
+
+  void Insert(const std::initializer_list<value_type> list) {
+    Insert(list.begin(), list.end());
+  }
+
+  std::pair<iterator, bool> InsertOrAssign(const Key& key, const T& value) {
+    const std::size_t hash{Hash{}(key)};
+    if (const std::size_t slot{FindSlot(key, hash)}; slot != kNotFound) {
+      entries_[index_[slot]].second = value;
+      return {begin() + index_[slot], false};
+    }
+
+    CheckRehash(1);
+    return {InsertUnchecked({key, value}, hash), true};
+  }
+
+  iterator Erase(const const_iterator position) {
+    const std::size_t entry{
+        static_cast<std::size_t>(std::distance(cbegin(), position))};
+    const std::size_t slot{FindSlot(position->first, Hash{}(position->first))};
+
+    EraseEntry(entry);
+    index_[slot] = kErasedSlot;
+    ++erased_;
+    for (std::uint32_t& other_slot : index_) {
+      if (other_slot > entry && other_slot < kErasedSlot) --other_slot;
+    }
+
+    return begin() + entry;
+  }
+
+  size_type Erase(const Key& key) {
+    const const_iterator it{Find(key)};
+    if (it == cend()) return 0;
+
+    Erase(it);
+    return 1;
+  }
+
+  void Swap(CompactOrderedMap& other) noexcept {
+    entries_.Swap(other.entries_);
+    index_.Swap(other.index_);
+    std::swap(erased_, other.erased_);
+    std::swap(max_load_factor_, other.max_load_factor_);
+  }
+
+  // Lookup
+
+  reference At(const Key& key) {
+    return const_cast<reference>(std::as_const(*this).At(key));
+  }
+  const_reference At(const Key& key) const {
+    const const_iterator it{Find(key)};
+    if (it == end()) throw std::out_of_range("key out of bounds");
+    return *it;
+  }
+
+  T& operator[](const Key& key) { return Insert({key, T()}).first->second; }
+
+  size_type Count(const Key& key) const { return Contains(key) ? 1 : 0; }
+
+  iterator Find(const Key& key) {
+    const std::size_t slot{FindSlot(key, Hash{}(key))};
+    return slot == kNotFound ? end() : begin() + index_[slot];
+  }
+  const_iterator Find(const Key& key) const {
+    const std::size_t slot{FindSlot(key, Hash{}(key))};
+    return slot == kNotFound ? end() : begin() + index_[slot];
+  }
+
+  bool Contains(const Key& key) const {
+    return FindSlot(key, Hash{}(key)) != kNotFound;
+  }
+
+  // Hash policy
+
+  size_type BucketCount() const { return index_.Size(); }
+
+  float LoadFactor() const {
+    return Empty() ? 0 : static_cast<float>(Size()) / BucketCount();
+  }
+
+  float MaxLoadFactor() const { return max_load_factor_; }
+  void MaxLoadFactor(const float max_load_factor) {
+    max_load_factor_ = std::min(max_load_factor, 0.95f);
+  }
+
+  void Rehash(const size_type count) {
+    const std::size_t min_count{
+        static_cast<std::size_t>(std::ceil(Size() / max_load_factor_))};
+    std::size_t new_size{kMinBucketCount};
+    while (new_size < std::max(min_count, count)) new_size *= 2;
+
+    DynamicArray<std::uint32_t> new_index;
+    new_index.Resize(new_size, kEmptySlot);
+    index_.Swap(new_index);
+    erased_ = 0;
+
+    for (std::size_t i{0}; i < Size(); ++i) {
+      index_[FreeSlot(Hash{}(entries_[i].first))] =
+          static_cast<std::uint32_t>(i);
+    }
+  }
+
+  void Reserve(const size_type count) {
+    entries_.Reserve(count);
+    Rehash(std::ceil(count / max_load_factor_));
+  }
+
+  // Comparison operators
+
+  bool operator==(const CompactOrderedMap& other) const noexcept {
+    if (Size() != other.Size()) return false;
+
+    for (const value_type& value : *this) {
+      const const_iterator it{other.Find(value.first)};
+      if (it == other.end() || it->second != value.second) return false;
+    }
+    return true;
+  }
+
+  bool operator!=(const CompactOrderedMap& other) const noexcept {
+    return !(*this == other);
+  }
+
+  // Debug
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const CompactOrderedMap& map) noexcept {
+    os << "[";
+
+    if (!map.Empty()) {
+      for (std::size_t i{0}; i < map.Size() - 1; ++i) {
+        os << map.entries_[i].first << " -> " << map.entries_[i].second
+           << ", ";
+      }
+      os << map.entries_.Back().first << " -> " << map.entries_.Back().second;
+    }
+
+    os << "] (" << map.Size() << ", buckets: " << map.BucketCount() << ")\n";
+    return os;
+  }
+
+ private:
+  static constexpr std::uint32_t kEmptySlot{UINT32_MAX};
+  static constexpr std::uint32_t kErasedSlot{UINT32_MAX - 1};
+  static constexpr std::size_t kNotFound{SIZE_MAX};
+  static constexpr std::size_t kMinBucketCount{8};
+
+  std::size_t FindSlot(const Key& key, const std::size_t hash) const {
+    if (Empty()) return kNotFound;
+
+    const std::size_t mask{BucketCount() - 1};
+    for (std::size_t i{hash & mask};; i = (i + 1) & mask) {
+      const std::uint32_t slot{index_[i]};
+      if (slot == kEmptySlot) return kNotFound;
+      if (slot != kErasedSlot && entries_[slot].first == key) return i;
+    }
+  }
+
+  std::size_t FreeSlot(const std::size_t hash) const {
+    const std::size_t mask{BucketCount() - 1};
+    std::size_t i{hash & mask};
+    while (index_[i] < kErasedSlot) i = (i + 1) & mask;
+    return i;
+  }
+
+  iterator InsertUnchecked(const value_type& value, const std::size_t hash) {
+    if (Size() >= kErasedSlot)
+      throw std::length_error("compact ordered map is full");
+
+    const std::size_t slot{FreeSlot(hash)};
+    entries_.PushBack(value);
+
+    if (index_[slot] == kErasedSlot) --erased_;
+    index_[slot] = static_cast<std::uint32_t>(Size() - 1);
+    return end() - 1;
+  }
+
+  // Removes the entry at `entry`, keeping the order of the others. Keys are
+  // const, so entries cannot be shifted down by assignment: they are rebuilt
+  // one slot lower when that cannot throw, and copied into a new array
+  // otherwise, so a failed copy leaves the entries unchanged. Callers update
+  // the index only once this has returned.
+  void EraseEntry(const std::size_t entry) {
+    if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
+      for (std::size_t i{entry}; i + 1 < Size(); ++i) {
+        value_type* const slot{&entries_[i]};
+        std::destroy_at(slot);
+        ::new (static_cast<void*>(slot))
+            value_type(std::move(entries_[i + 1]));
+      }
+      entries_.PopBack();
+    } else {
+      DynamicArray<value_type> entries;
+      entries.Reserve(Size() - 1);
+      for (std::size_t i{0}; i < Size(); ++i) {
+        if (i != entry) entries.PushBack(entries_[i]);
+      }
+      entries_.Swap(entries);
+    }
+  }
+
+  void CheckRehash(const std::size_t additional) {
+    const std::size_t new_size{Size() + erased_ + additional};
+    if (new_size <= max_load_factor_ * BucketCount()) return;
+
+    const std::size_t required{static_cast<std::size_t>(
+        std::ceil((Size() + additional) / max_load_factor_))};
+    Rehash(required > BucketCount() ? std::max(required, BucketCount() * 2)
+                                    : BucketCount());
+  }
+
+  DynamicArray<value_type> entries_;
+  DynamicArray<std::uint32_t> index_;
+  std::size_t erased_{0};
+  float max_load_factor_{0.75};
+};
+
+#endif  // CPP_ALGORITHMS_DATA_STRUCTURES_COMPACT_ORDERED_MAP_COMPACT_ORDERED_MAP_H_
@@ -0,0 +1,293 @@
+#include "compact_ordered_map.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using Pair = std::pair<const int, int>;
+
+struct ThrowingCopy {
+  ThrowingCopy(const int value) : value{value} {}
+  ThrowingCopy(const ThrowingCopy& other) : value{other.value} {
+    if (throw_on_copy) throw std::runtime_error("copy failed");
+  }
+  ThrowingCopy& operator=(const ThrowingCopy& other) = default;
+
+  static inline bool throw_on_copy{false};
+  int value;
+};
+
+// Constructors
+
+TEST(CompactOrderedMapTest, Constructor) {
+  const CompactOrderedMap<int, int> map;
+  EXPECT_EQ(map.Size(), 0);
+  EXPECT_EQ(map.BucketCount(), 0);
+}
+
+TEST(CompactOrderedMapTest, CopyConstructor) {
+  const CompactOrderedMap<int, int> map{{1, 1}, {2, 4}, {3, 9}};
+
+  const CompactOrderedMap<int, int> copy{map};
+  EXPECT_EQ(copy, map);
+}
+
+TEST(CompactOrderedMapTest, MoveConstructor) {
+  CompactOrderedMap<int, int> map{{1, 1}, {2, 4}, {3, 9}};
+
+  const CompactOrderedMap<int, int> moved_map{std::move(map)};
+  EXPECT_EQ(moved_map.Size(), 3);
+  EXPECT_EQ(map.Size(), 0);
+}
+
+TEST(CompactOrderedMapTest, InitializerListConstructor) {
+  const CompactOrderedMap<int, int> map{{3, 9}, {1, 1}, {2, 4}, {1, 2}};
+  EXPECT_EQ(map.Size(), 3);
+  EXPECT_EQ(map.At(1), (Pair{1, 1}));
+  EXPECT_EQ(map.At(2), (Pair{2, 4}));
+  EXPECT_EQ(map.At(3), (Pair{3, 9}));
+}
+
+// Assignments
+
+TEST(CompactOrderedMapTest, CopyAssignment) {
+  const CompactOrderedMap<int, int> map{{1, 1}, {2, 4}, {3, 9}};
+  CompactOrderedMap<int, int> copy{{4, 16}};
+
+  copy = map;
+  EXPECT_EQ(copy, map);
+}
+
+TEST(CompactOrderedMapTest, MoveAssignment) {
+  CompactOrderedMap<int, int> map{{1, 1}, {2, 4}, {3, 9}};
+  CompactOrderedMap<int, int> moved_map;
+
+  moved_map = std::move(map);
+  EXPECT_EQ(moved_map.Size(), 3);
+  EXPECT_EQ(map.Size(), 0);
+}
+
+// Iterators
+
+TEST(CompactOrderedMapTest, InsertionOrder) {
+  CompactOrderedMap<int, int> map;
+  for (int i{100}; i > 0; --i) {
+    map.Insert({i * 7919 % 1000, i});
+  }
+
+  int expected{100};
+  for (const auto& [key, value] : map) {
+    EXPECT_EQ(key, expected * 7919 % 1000);
+    EXPECT_EQ(value, expected);
+    --expected;
+  }
+  EXPECT_EQ(expected, 0);
+}
+
+TEST(CompactOrderedMapTest, Begin_ConstKey) {
+  CompactOrderedMap<int, int> map{{1, 1}};
+
+  // Keys cannot be changed through iterators, which would corrupt the index.
+  static_assert(std::is_const_v<std::remove_reference_t<decltype(
+                    map.begin()->first)>>);
+  static_assert(
+      std::is_const_v<std::remove_reference_t<decltype(map.At(1).first)>>);
+
+  map.begin()->second = 2;
+  EXPECT_EQ(map.At(1).second, 2);
+}
+
+TEST(CompactOrderedMapTest, Rbegin) {
+  const CompactOrderedMap<int, int> map{{1, 1}, {2, 4}, {3, 9}};
+  EXPECT_EQ(*map.rbegin(), (Pair{3, 9}));
+}
+
+// Capacity
+
+TEST(CompactOrderedMapTest, Empty) {
+  const CompactOrderedMap<int, int> empty_map;
+  EXPECT_TRUE(empty_map.Empty());
+
+  const CompactOrderedMap<int, int> map{{1, 1}};
+  EXPECT_FALSE(map.Empty());
+}
+
+// Modifiers
+
+TEST(CompactOrderedMapTest, Clear) {
+  CompactOrderedMap<int, int> map{{1, 1}, {2, 4}, {3, 9}};
+
+  map.Clear();
+  EXPECT_TRUE(map.Empty());
+  EXPECT_FALSE(map.Contains(1));
+
+  map.Insert({4, 16});
+  EXPECT_EQ(map.At(4), (Pair{4, 16}));
+}
+
+TEST(CompactOrderedMapTest, Insert) {
+  CompactOrderedMap<int, int> map;
+
+  auto [it, inserted] = map.Insert({1, 1});
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(*it, (Pair{1, 1}));
+
+  std::tie(it, inserted) = map.Insert({1, 2});
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(*it, (Pair{1, 1}));
+}
+
+TEST(CompactOrderedMapTest, Insert_Many) {
+  CompactOrderedMap<int, int> map;
+  for (int i{0}; i < 10000; ++i) {
+    map.Insert({i, -i});
+  }
+  EXPECT_EQ(map.Size(), 10000);
+  EXPECT_LE(map.LoadFactor(), map.MaxLoadFactor());
+
+  for (int i{0}; i < 10000; ++i) {
+    EXPECT_EQ(map.At(i).second, -i);
+  }
+}
+
+TEST(CompactOrderedMapTest, Insert_ThrowingCopy) {
+  CompactOrderedMap<int, ThrowingCopy> map{{1, 1}, {2, 4}};
+
+  ThrowingCopy::throw_on_copy = true;
+  EXPECT_THROW(map.Insert({3, 9}), std::runtime_error);
+  ThrowingCopy::throw_on_copy = false;
+
+  EXPECT_EQ(map.Size(), 2);
+  EXPECT_FALSE(map.Contains(3));
+  EXPECT_EQ(map.At(2).second.value, 4);
+}
+
+TEST(CompactOrderedMapTest, InsertOrAssign) {
+  CompactOrderedMap<int, int> map{{1, 1}, {2, 4}};
+
+  EXPECT_FALSE(map.InsertOrAssign(1, 2).second);
+  EXPECT_TRUE(map.InsertOrAssign(3, 9).second);
+  EXPECT_EQ(map, (CompactOrderedMap<int, int>{{1, 2}, {2, 4}, {3, 9}}));
+  EXPECT_EQ(map.begin()->second, 2);
+}
+
+TEST(CompactOrderedMapTest, Erase_Iterator) {
+  CompactOrderedMap<int, int> map{{1, 1}, {2, 4}, {3, 9}};
+
+  const auto next{map.Erase(map.Find(2))};
+  EXPECT_EQ(*next, (Pair{3, 9}));
+  EXPECT_EQ(map.Size(), 2);
+  EXPECT_EQ(*map.begin(), (Pair{1, 1}));
+  EXPECT_EQ(map.At(3), (Pair{3, 9}));
+}
+
+TEST(CompactOrderedMapTest, Erase_Key) {
+  CompactOrderedMap<int, int> map{{1, 1}, {2, 4}, {3, 9}, {4, 16}};
+
+  EXPECT_EQ(map.Erase(1), 1);
+  EXPECT_EQ(map.Erase(1), 0);
+  EXPECT_EQ(map.Erase(3), 1);
+
+  map.Insert({5, 25});
+  const CompactOrderedMap<int, int> expected{{2, 4}, {4, 16}, {5, 25}};
+  EXPECT_EQ(map, expected);
+  EXPECT_TRUE(std::equal(map.begin(), map.end(), expected.begin()));
+}
+
+TEST(CompactOrderedMapTest, Erase_StringKeys) {
+  CompactOrderedMap<std::string, int> map{{"one", 1}, {"two", 2}, {"three", 3}};
+
+  map.Erase(map.begin());
+  EXPECT_EQ(map.begin()->first, "two");
+  EXPECT_EQ(map.At("three").second, 3);
+  EXPECT_FALSE(map.Contains("one"));
+}
+
+TEST(CompactOrderedMapTest, Erase_ThrowingCopy) {
+  CompactOrderedMap<int, ThrowingCopy> map{{1, 1}, {2, 4}, {3, 9}};
+
+  ThrowingCopy::throw_on_copy = true;
+  EXPECT_THROW(map.Erase(1), std::runtime_error);
+  ThrowingCopy::throw_on_copy = false;
+
+  EXPECT_EQ(map.Size(), 3);
+  EXPECT_EQ(map.At(1).second.value, 1);
+  EXPECT_EQ(map.At(2).second.value, 4);
+  EXPECT_EQ(map.At(3).second.value, 9);
+}
+
+TEST(CompactOrderedMapTest, Swap) {
+  CompactOrderedMap<int, int> a{{1, 1}, {2, 4}};
+  CompactOrderedMap<int, int> b{{3, 9}};
+  const CompactOrderedMap<int, int> expected_a{b};
+  const CompactOrderedMap<int, int> expected_b{a};
+
+  a.Swap(b);
+  EXPECT_EQ(a, expected_a);
+  EXPECT_EQ(b, expected_b);
+}
+
+// Lookup
+
+TEST(CompactOrderedMapTest, At) {
+  CompactOrderedMap<int, int> map{{1, 1}};
+  EXPECT_EQ(map.At(1), (Pair{1, 1}));
+  EXPECT_THROW(map.At(2), std::out_of_range);
+}
+
+TEST(CompactOrderedMapTest, SubscriptOperator) {
+  CompactOrderedMap<int, int> map;
+
+  map[2] = 4;
+  EXPECT_EQ(map[2], 4);
+  EXPECT_EQ(map[3], 0);
+  EXPECT_EQ(map.Size(), 2);
+}
+
+TEST(CompactOrderedMapTest, Count) {
+  const CompactOrderedMap<int, int> map{{1, 1}};
+  EXPECT_EQ(map.Count(1), 1);
+  EXPECT_EQ(map.Count(2), 0);
+}
+
+TEST(CompactOrderedMapTest, Find) {
+  const CompactOrderedMap<int, int> map{{1, 1}, {2, 4}};
+  EXPECT_EQ(*map.Find(2), (Pair{2, 4}));
+  EXPECT_EQ(map.Find(3), map.end());
+}
+
+// Hash policy
+
+TEST(CompactOrderedMapTest, Rehash) {
+  CompactOrderedMap<int, int> map{{1, 1}};
+
+  map.Rehash(100);
+  EXPECT_EQ(map.BucketCount(), 128);
+  EXPECT_EQ(map.At(1), (Pair{1, 1}));
+}
+
+TEST(CompactOrderedMapTest, Reserve) {
+  CompactOrderedMap<int, int> map;
+
+  map.Reserve(96);
+  EXPECT_EQ(map.BucketCount(), 128);
+  EXPECT_EQ(map.Capacity(), 96);
+}
+
+// Comparison operators
+
+TEST(CompactOrderedMapTest, EqualOperator) {
+  const CompactOrderedMap<int, int> a{{1, 1}, {2, 4}, {3, 9}};
+  const CompactOrderedMap<int, int> b{{3, 9}, {2, 4}, {1, 1}};
+  EXPECT_EQ(a, b);
+}
+
+TEST(CompactOrderedMapTest, NotEqualOperator) {
+  const CompactOrderedMap<int, int> a{{1, 1}, {2, 4}, {3, 9}};
+  const CompactOrderedMap<int, int> b{{4, 16}, {5, 25}, {6, 36}};
+  EXPECT_NE(a, b);
+}
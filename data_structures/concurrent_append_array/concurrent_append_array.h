@@ -0,0 +1,247 @@
+#ifndef CPP_ALGORITHMS_DATA_STRUCTURES_CONCURRENT_APPEND_ARRAY_CONCURRENT_APPEND_ARRAY_H_
+#define CPP_ALGORITHMS_DATA_STRUCTURES_CONCURRENT_APPEND_ARRAY_CONCURRENT_APPEND_ARRAY_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+#include "bits.h"
+#include "dynamic_array.h"
+
+// Append-only array that any number of threads may push to and read from at
+// the same time. A push reserves its index with a compare-and-swap on the
+// size, builds the element in place and then publishes it through a
+// per-slot state. No thread ever blocks, but PushBack is lock-free rather
+// than wait-free: a push whose compare-and-swap loses to another push
+// retries, so under contention a single push may retry without bound while
+// the others complete. Storage is laid out like SegmentedArray, in chunks of
+// kFirstChunkSize << k slots, so elements never move. The chunk holding an
+// index is installed before the index is reserved, so a failed allocation
+// reserves nothing. A push whose constructor throws leaves a failed slot
+// behind, which counts towards Size() but is never published.
+//
+// Construction, destruction and Clear must not race with other calls.
+template <class T>
+class ConcurrentAppendArray {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+  static constexpr std::size_t kFirstChunkShift{4};
+  static constexpr std::size_t kFirstChunkSize{std::size_t{1}
+                                               << kFirstChunkShift};
+  static constexpr std::size_t kMaxChunkCount{
+      std::numeric_limits<std::size_t>::digits - kFirstChunkShift};
+
+  // Constructors
+
+  ConcurrentAppendArray() noexcept = default;
+
+  ConcurrentAppendArray(const ConcurrentAppendArray& other) = delete;
+
+  ~ConcurrentAppendArray() {
+    Clear();
+    for (std::size_t chunk{0}; chunk < kMaxChunkCount; ++chunk) {
+      delete[] chunks_[chunk].load(std::memory_order_relaxed);
+    }
+  }
+
+  // Assignments
+
+  ConcurrentAppendArray& operator=(const ConcurrentAppendArray& other) =
+      delete;
+
+  // Element access
+
+  // The element at `index`, which must have been published, e.g. because the
+  // push that returned `index` happened before this call.
+  reference operator[](const size_type index) {
+    return const_cast<reference>(std::as_const(*this)[index]);
+  }
+  const_reference operator[](const size_type index) const {
+    return *SlotAt(index).Value();
+  }
+
+  const_reference At(const size_type index) const {
+    if (!IsPublished(index)) {
+      throw std::out_of_range("index out of bounds or not yet published");
+    }
+    return (*this)[index];
+  }
+
+  // Whether the element at `index` has been fully constructed and can be
+  // read from this thread.
+  bool IsPublished(const size_type index) const noexcept {
+    if (index >= Size()) return false;
+
+    const Slot* const chunk{
+        chunks_[ChunkOf(index)].load(std::memory_order_acquire)};
+    return chunk != nullptr &&
+           chunk[IndexInChunk(index)].state.load(std::memory_order_acquire) ==
+               State::kPublished;
+  }
+
+  // Copies the published elements up to the first push still in progress
+  // into a plain array, leaving out failed pushes.
+  DynamicArray<T> Snapshot() const {
+    DynamicArray<T> snapshot;
+    const std::size_t size{Size()};
+    snapshot.Reserve(size);
+
+    for (std::size_t i{0}; i < size; ++i) {
+      const State state{SlotAt(i).state.load(std::memory_order_acquire)};
+      if (state == State::kPending) break;
+      if (state == State::kPublished) snapshot.PushBack((*this)[i]);
+    }
+    return snapshot;
+  }
+
+  // Capacity
+
+  bool Empty() const noexcept { return Size() == 0; }
+
+  // Number of reserved indices, including pushes still in progress and
+  // pushes that failed.
+  size_type Size() const noexcept {
+    return size_.load(std::memory_order_acquire);
+  }
+
+  // Installs chunks until `new_capacity` slots exist, so that pushes below it
+  // never allocate.
+  void Reserve(const size_type new_capacity) {
+    if (new_capacity == 0) return;
+
+    for (std::size_t chunk{0}; chunk <= ChunkOf(new_capacity - 1); ++chunk) {
+      LoadOrInstallChunk(chunk);
+    }
+  }
+
+  // Modifiers
+
+  // Destroys the elements but keeps the chunks for reuse.
+  void Clear() noexcept {
+    const std::size_t size{Size()};
+    for (std::size_t i{0}; i < size; ++i) {
+      Slot& slot{SlotAt(i)};
+      if (slot.state.load(std::memory_order_relaxed) == State::kPublished) {
+        slot.Value()->~T();
+      }
+      slot.state.store(State::kPending, std::memory_order_relaxed);
+    }
+    size_.store(0, std::memory_order_release);
+  }
+
+  // Appends the element and returns its index.
+  size_type PushBack(const_reference value) { return EmplaceBack(value); }
+
+  size_type PushBack(T&& value) { return EmplaceBack(std::move(value)); }
+
+  // If the constructor throws, the reserved index is marked as failed and
+  // the exception is rethrown.
+  template <class... Args>
+  size_type EmplaceBack(Args&&... args) {
+    const std::size_t index{ReserveIndex()};
+
+    Slot& slot{SlotAt(index)};
+    try {
+      ::new (static_cast<void*>(slot.storage)) T(std::forward<Args>(args)...);
+    } catch (...) {
+      slot.state.store(State::kFailed, std::memory_order_release);
+      throw;
+    }
+    slot.state.store(State::kPublished, std::memory_order_release);
+    return index;
+  }
+
+  // Debug
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const ConcurrentAppendArray& array) {
+    const DynamicArray<T> snapshot{array.Snapshot()};
+    os << "[";
+    for (std::size_t i{0}; i < snapshot.Size(); ++i) {
+      if (i != 0) os << ", ";
+      os << snapshot[i];
+    }
+    os << "] (" << snapshot.Size() << "/" << array.Size() << ")\n";
+    return os;
+  }
+
+ private:
+  enum class State : std::uint8_t { kPending, kPublished, kFailed };
+
+  struct Slot {
+    T* Value() noexcept {
+      return std::launder(reinterpret_cast<T*>(storage));
+    }
+    const T* Value() const noexcept {
+      return std::launder(reinterpret_cast<const T*>(storage));
+    }
+
+    std::atomic<State> state{State::kPending};
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  static constexpr std::size_t ChunkCapacity(const std::size_t chunk) noexcept {
+    return kFirstChunkSize << chunk;
+  }
+
+  static std::size_t ChunkOf(const std::size_t index) noexcept {
+    return HighestBit(index + kFirstChunkSize) - kFirstChunkShift;
+  }
+
+  static std::size_t IndexInChunk(const std::size_t index) noexcept {
+    return index + kFirstChunkSize - ChunkCapacity(ChunkOf(index));
+  }
+
+  Slot& SlotAt(const std::size_t index) const noexcept {
+    return chunks_[ChunkOf(index)].load(std::memory_order_acquire)
+        [IndexInChunk(index)];
+  }
+
+  // Claims the next index once the chunk holding it is installed, so an
+  // allocation failure leaves the size unchanged. A single fetch_add would
+  // make this wait-free, but an index reserved that way whose chunk then
+  // fails to allocate could never be marked as failed.
+  std::size_t ReserveIndex() {
+    std::size_t index{size_.load(std::memory_order_acquire)};
+    do {
+      LoadOrInstallChunk(ChunkOf(index));
+    } while (!size_.compare_exchange_weak(index, index + 1,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire));
+    return index;
+  }
+
+  // Returns the chunk, allocating it if no other thread has yet. When two
+  // threads race, the loser frees its allocation and uses the winner's.
+  Slot* LoadOrInstallChunk(const std::size_t chunk) {
+    if (chunk >= kMaxChunkCount) throw std::bad_alloc();
+
+    Slot* current{chunks_[chunk].load(std::memory_order_acquire)};
+    if (current != nullptr) return current;
+
+    Slot* const allocated{new Slot[ChunkCapacity(chunk)]};
+    if (chunks_[chunk].compare_exchange_strong(current, allocated,
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_acquire)) {
+      return allocated;
+    }
+    delete[] allocated;
+    return current;
+  }
+
+  std::atomic<Slot*> chunks_[kMaxChunkCount]{};
+  std::atomic<std::size_t> size_{0};
+};
+
+#endif  // CPP_ALGORITHMS_DATA_STRUCTURES_CONCURRENT_APPEND_ARRAY_CONCURRENT_APPEND_ARRAY_H_
@@ -0,0 +1,200 @@
+#include "concurrent_append_array.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "dynamic_array.h"
+
+constexpr std::size_t kThreadCount{8};
+constexpr std::size_t kPushesPerThread{20000};
+
+// Value whose constructor throws for negative inputs.
+struct Checked {
+  explicit Checked(const int value) : value{value} {
+    if (value < 0) throw std::invalid_argument("negative value");
+  }
+
+  int value;
+};
+
+// Constructors
+
+TEST(ConcurrentAppendArrayTest, Constructor) {
+  const ConcurrentAppendArray<int> array;
+  EXPECT_TRUE(array.Empty());
+  EXPECT_FALSE(array.IsPublished(0));
+  EXPECT_TRUE(array.Snapshot().Empty());
+}
+
+// Element access
+
+TEST(ConcurrentAppendArrayTest, At) {
+  ConcurrentAppendArray<std::string> array;
+  array.PushBack("a");
+
+  EXPECT_EQ(array.At(0), "a");
+  EXPECT_THROW(array.At(1), std::out_of_range);
+}
+
+TEST(ConcurrentAppendArrayTest, SubscriptOperator) {
+  ConcurrentAppendArray<std::size_t> array;
+  for (std::size_t i{0}; i < 1000; ++i) {
+    EXPECT_EQ(array.PushBack(i * 3), i);
+  }
+
+  for (std::size_t i{0}; i < 1000; ++i) {
+    EXPECT_EQ(array[i], i * 3);
+  }
+  array[5] = 0;
+  EXPECT_EQ(array[5], 0);
+}
+
+TEST(ConcurrentAppendArrayTest, Snapshot) {
+  ConcurrentAppendArray<int> array;
+  array.PushBack(1);
+  array.EmplaceBack(2);
+
+  EXPECT_EQ(array.Snapshot(), (DynamicArray<int>{1, 2}));
+}
+
+// Capacity
+
+TEST(ConcurrentAppendArrayTest, Reserve) {
+  ConcurrentAppendArray<int> array;
+  array.Reserve(100);
+  EXPECT_TRUE(array.Empty());
+
+  const std::size_t index{array.PushBack(4)};
+  EXPECT_EQ(array[index], 4);
+}
+
+// Modifiers
+
+TEST(ConcurrentAppendArrayTest, PushBack_StableAddresses) {
+  ConcurrentAppendArray<std::string> array;
+  const std::string* const first{&array[array.PushBack("first")]};
+  for (int i{0}; i < 1000; ++i) {
+    array.PushBack(std::to_string(i));
+  }
+
+  EXPECT_EQ(&array[0], first);
+  EXPECT_EQ(*first, "first");
+}
+
+TEST(ConcurrentAppendArrayTest, PushBack_Concurrent) {
+  ConcurrentAppendArray<std::size_t> array;
+
+  std::vector<std::thread> threads;
+  for (std::size_t t{0}; t < kThreadCount; ++t) {
+    threads.emplace_back([&array, t]() {
+      for (std::size_t i{0}; i < kPushesPerThread; ++i) {
+        array.PushBack(t * kPushesPerThread + i);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  DynamicArray<std::size_t> snapshot{array.Snapshot()};
+  ASSERT_EQ(snapshot.Size(), kThreadCount * kPushesPerThread);
+
+  // Each thread's values appear in the order it pushed them.
+  DynamicArray<std::size_t> next;
+  next.Resize(kThreadCount);
+  for (const std::size_t value : snapshot) {
+    const std::size_t thread{value / kPushesPerThread};
+    EXPECT_EQ(value % kPushesPerThread, next[thread]);
+    ++next[thread];
+  }
+
+  std::sort(snapshot.begin(), snapshot.end());
+  for (std::size_t i{0}; i < snapshot.Size(); ++i) {
+    EXPECT_EQ(snapshot[i], i);
+  }
+}
+
+TEST(ConcurrentAppendArrayTest, PushBack_ConcurrentReaders) {
+  ConcurrentAppendArray<std::string> array;
+  std::atomic<bool> done{false};
+
+  std::thread reader{[&]() {
+    while (!done.load()) {
+      const DynamicArray<std::string> snapshot{array.Snapshot()};
+      for (std::size_t i{0}; i < snapshot.Size(); ++i) {
+        ASSERT_EQ(snapshot[i].size(), 32);
+      }
+    }
+  }};
+
+  std::vector<std::thread> writers;
+  for (std::size_t t{0}; t < kThreadCount / 2; ++t) {
+    writers.emplace_back([&array]() {
+      for (std::size_t i{0}; i < kPushesPerThread / 10; ++i) {
+        array.EmplaceBack(32, 'x');
+      }
+    });
+  }
+  for (std::thread& writer : writers) {
+    writer.join();
+  }
+  done.store(true);
+  reader.join();
+
+  EXPECT_EQ(array.Size(), kThreadCount / 2 * kPushesPerThread / 10);
+  EXPECT_EQ(array.Snapshot().Size(), array.Size());
+}
+
+TEST(ConcurrentAppendArrayTest, EmplaceBack_Throwing) {
+  ConcurrentAppendArray<Checked> array;
+  array.EmplaceBack(1);
+  EXPECT_THROW(array.EmplaceBack(-1), std::invalid_argument);
+  array.EmplaceBack(3);
+
+  EXPECT_EQ(array.Size(), 3);
+  EXPECT_FALSE(array.IsPublished(1));
+  EXPECT_THROW(array.At(1), std::out_of_range);
+
+  // The failed push is skipped rather than ending the snapshot.
+  const DynamicArray<Checked> snapshot{array.Snapshot()};
+  ASSERT_EQ(snapshot.Size(), 2);
+  EXPECT_EQ(snapshot[0].value, 1);
+  EXPECT_EQ(snapshot[1].value, 3);
+
+  array.Clear();
+  array.EmplaceBack(4);
+  EXPECT_EQ(array.Snapshot().Size(), 1);
+}
+
+TEST(ConcurrentAppendArrayTest, Clear) {
+  ConcurrentAppendArray<std::string> array;
+  array.PushBack("a");
+  array.PushBack("b");
+
+  array.Clear();
+  EXPECT_TRUE(array.Empty());
+  EXPECT_FALSE(array.IsPublished(0));
+
+  array.PushBack("c");
+  EXPECT_EQ(array.Snapshot(), (DynamicArray<std::string>{"c"}));
+}
+
+// Debug
+
+TEST(ConcurrentAppendArrayTest, OutputOperator) {
+  ConcurrentAppendArray<int> array;
+  array.PushBack(1);
+  array.PushBack(2);
+
+  std::ostringstream os;
+  os << array;
+  EXPECT_EQ(os.str(), "[1, 2] (2/2)\n");
+}
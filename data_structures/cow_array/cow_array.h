@@ -0,0 +1,294 @@
+#ifndef CPP_ALGORITHMS_DATA_STRUCTURES_COW_ARRAY_COW_ARRAY_H_
+#define CPP_ALGORITHMS_DATA_STRUCTURES_COW_ARRAY_COW_ARRAY_H_
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "dynamic_array.h"
+
+// Growable array whose copies share one buffer until either side changes
+// it, so copying is O(1) whatever the size. The first mutation through a
+// shared copy clones the elements into a buffer of its own. The reference
+// count is atomic: a copy can be handed to another thread and read there
+// while the original keeps changing. A single CowArray object is no more
+// thread-safe than a DynamicArray.
+//
+// Every non-const member that hands out a reference, pointer or iterator to
+// the elements, including non-const begin() and operator[], unshares the
+// buffer and pins it: the reference could still write to it later, so
+// copies made from a pinned array clone the elements instead of sharing
+// them. Read through a const reference or cbegin(), and write with Set(),
+// to keep copies O(1).
+template <class T, class Allocator = std::allocator<T>>
+class CowArray {
+ public:
+  static_assert(std::is_copy_constructible_v<T>,
+                "shared elements are cloned by copying");
+
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = typename DynamicArray<T, Allocator>::iterator;
+  using const_iterator = typename DynamicArray<T, Allocator>::const_iterator;
+
+  // Constructors
+
+  CowArray() noexcept = default;
+
+  CowArray(const CowArray& other) {
+    if (other.buffer_ == nullptr) return;
+
+    if (other.buffer_->pinned) {
+      buffer_ = NewBuffer(other.buffer_->elements);
+    } else {
+      buffer_ = other.buffer_;
+      buffer_->references.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  CowArray(CowArray&& other) noexcept { Swap(other); }
+
+  CowArray(const std::initializer_list<T> list)
+      : CowArray(DynamicArray<T, Allocator>(list)) {}
+
+  explicit CowArray(DynamicArray<T, Allocator> elements)
+      : buffer_{NewBuffer(std::move(elements))} {}
+
+  ~CowArray() { Release(); }
+
+  // Assignments
+
+  CowArray& operator=(const CowArray& other) {
+    CowArray temp{other};
+    Swap(temp);
+    return *this;
+  }
+
+  CowArray& operator=(CowArray&& other) noexcept {
+    if (this == &other) return *this;
+
+    Release();
+    Swap(other);
+
+    return *this;
+  }
+
+  CowArray& operator=(const std::initializer_list<T> list) {
+    CowArray temp{list};
+    Swap(temp);
+    return *this;
+  }
+
+  // Element access
+
+  reference At(const size_type index) {
+    if (index >= Size()) throw std::out_of_range("index out of bounds");
+    return Pin()[index];
+  }
+  const_reference At(const size_type index) const {
+    if (index >= Size()) throw std::out_of_range("index out of bounds");
+    return buffer_->elements[index];
+  }
+
+  reference operator[](const size_type index) { return Pin()[index]; }
+  const_reference operator[](const size_type index) const {
+    return buffer_->elements[index];
+  }
+
+  reference Front() { return Pin().Front(); }
+  const_reference Front() const { return buffer_->elements.Front(); }
+
+  reference Back() { return Pin().Back(); }
+  const_reference Back() const { return buffer_->elements.Back(); }
+
+  pointer Data() { return buffer_ == nullptr ? nullptr : Pin().Data(); }
+  const_pointer Data() const noexcept {
+    return buffer_ == nullptr ? nullptr : buffer_->elements.Data();
+  }
+
+  // Iterators
+
+  iterator begin() {
+    return buffer_ == nullptr ? iterator(nullptr) : Pin().begin();
+  }
+  const_iterator begin() const noexcept {
+    return buffer_ == nullptr ? const_iterator(nullptr)
+                              : buffer_->elements.begin();
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  iterator end() {
+    return buffer_ == nullptr ? iterator(nullptr) : Pin().end();
+  }
+  const_iterator end() const noexcept {
+    return buffer_ == nullptr ? const_iterator(nullptr)
+                              : buffer_->elements.end();
+  }
+  const_iterator cend() const noexcept { return end(); }
+
+  // Capacity
+
+  bool Empty() const noexcept { return Size() == 0; }
+
+  size_type Size() const noexcept {
+    return buffer_ == nullptr ? 0 : buffer_->elements.Size();
+  }
+
+  size_type Capacity() const noexcept {
+    return buffer_ == nullptr ? 0 : buffer_->elements.Capacity();
+  }
+
+  void Reserve(const size_type new_capacity) {
+    if (new_capacity > Capacity()) Unshare().Reserve(new_capacity);
+  }
+
+  void ShrinkToFit() {
+    if (Capacity() != Size()) Unshare().ShrinkToFit();
+  }
+
+  // Number of CowArray objects sharing the buffer, or 0 for an empty array
+  // that never allocated one.
+  size_type UseCount() const noexcept {
+    return buffer_ == nullptr
+               ? 0
+               : buffer_->references.load(std::memory_order_relaxed);
+  }
+
+  // Modifiers
+
+  // Drops the buffer rather than clearing it, so copies keep their elements
+  // without a clone.
+  void Clear() noexcept { Release(); }
+
+  // Assigns `value` to the element at `index` without pinning the buffer.
+  void Set(const size_type index, const_reference value) {
+    if (index >= Size()) throw std::out_of_range("index out of bounds");
+    Unshare()[index] = value;
+  }
+
+  void PushBack(const_reference value) { Unshare().PushBack(value); }
+
+  void PushBack(T&& value) { Unshare().PushBack(std::move(value)); }
+
+  template <class... Args>
+  reference EmplaceBack(Args&&... args) {
+    return Pin().EmplaceBack(std::forward<Args>(args)...);
+  }
+
+  void PopBack() { Unshare().PopBack(); }
+
+  void Resize(const size_type new_size) { Unshare().Resize(new_size); }
+
+  void Resize(const size_type new_size, const_reference value) {
+    Unshare().Resize(new_size, value);
+  }
+
+  void Swap(CowArray& other) noexcept { std::swap(buffer_, other.buffer_); }
+
+  // Comparison operators
+
+  bool operator==(const CowArray& other) const noexcept {
+    if (buffer_ == other.buffer_) return true;
+    if (Size() != other.Size()) return false;
+    return Empty() || buffer_->elements == other.buffer_->elements;
+  }
+
+  bool operator!=(const CowArray& other) const noexcept {
+    return !(*this == other);
+  }
+
+  // Debug
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const CowArray& array) noexcept {
+    os << "[";
+    for (std::size_t i{0}; i < array.Size(); ++i) {
+      if (i != 0) os << ", ";
+      os << array[i];
+    }
+    os << "] (" << array.Size() << ", shared: " << array.UseCount() << ")\n";
+    return os;
+  }
+
+ private:
+  struct Buffer {
+    explicit Buffer(DynamicArray<T, Allocator> elements)
+        : elements{std::move(elements)} {}
+
+    DynamicArray<T, Allocator> elements;
+    std::atomic<std::size_t> references{1};
+    // Only ever set while the buffer is not shared, and read by copies of
+    // its single owner, so it needs no synchronization.
+    bool pinned{false};
+  };
+
+  using BufferAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Buffer>;
+
+  // The buffer comes from `Allocator` like the elements, so an array filled
+  // in an ArenaScope takes no memory from the heap.
+  template <class... Args>
+  static Buffer* NewBuffer(Args&&... args) {
+    BufferAllocator buffer_allocator;
+    Buffer* const buffer{buffer_allocator.allocate(1)};
+    try {
+      ::new (static_cast<void*>(buffer)) Buffer(std::forward<Args>(args)...);
+    } catch (...) {
+      buffer_allocator.deallocate(buffer, 1);
+      throw;
+    }
+    return buffer;
+  }
+
+  static void DeleteBuffer(Buffer* const buffer) noexcept {
+    std::destroy_at(buffer);
+    BufferAllocator buffer_allocator;
+    buffer_allocator.deallocate(buffer, 1);
+  }
+
+  // Returns the elements for writing, cloning them first when another copy
+  // shares the buffer. A count of 1 cannot change under us: any other
+  // reference would have to be copied from this object.
+  DynamicArray<T, Allocator>& Unshare() {
+    if (buffer_ == nullptr) {
+      buffer_ = NewBuffer(DynamicArray<T, Allocator>());
+    } else if (buffer_->references.load(std::memory_order_acquire) != 1) {
+      Buffer* const buffer{NewBuffer(buffer_->elements)};
+      Release();
+      buffer_ = buffer;
+    }
+    return buffer_->elements;
+  }
+
+  // Unshares the elements and keeps later copies from sharing them, for a
+  // caller about to hand out a reference into them.
+  DynamicArray<T, Allocator>& Pin() {
+    DynamicArray<T, Allocator>& elements{Unshare()};
+    buffer_->pinned = true;
+    return elements;
+  }
+
+  void Release() noexcept {
+    if (buffer_ == nullptr) return;
+    if (buffer_->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      DeleteBuffer(buffer_);
+    }
+    buffer_ = nullptr;
+  }
+
+  Buffer* buffer_{nullptr};
+};
+
+#endif  // CPP_ALGORITHMS_DATA_STRUCTURES_COW_ARRAY_COW_ARRAY_H_
@@ -0,0 +1,272 @@
+#include "cow_array.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+// Constructors
+
+TEST(CowArrayTest, Constructor) {
+  const CowArray<int> array;
+  EXPECT_TRUE(array.Empty());
+  EXPECT_EQ(array.UseCount(), 0);
+  EXPECT_EQ(array.begin(), array.end());
+  EXPECT_EQ(array.Data(), nullptr);
+}
+
+TEST(CowArrayTest, CopyConstructor) {
+  const CowArray<int> array{1, 2, 3};
+  const CowArray<int> copy{array};
+  EXPECT_EQ(copy, array);
+  EXPECT_EQ(copy.Data(), array.Data());
+  EXPECT_EQ(array.UseCount(), 2);
+}
+
+TEST(CowArrayTest, MoveConstructor) {
+  CowArray<int> array{1, 2, 3};
+  const CowArray<int> moved_array{std::move(array)};
+  EXPECT_EQ(moved_array, (CowArray<int>{1, 2, 3}));
+  EXPECT_EQ(moved_array.UseCount(), 1);
+  EXPECT_TRUE(array.Empty());
+}
+
+TEST(CowArrayTest, DynamicArrayConstructor) {
+  DynamicArray<std::string> elements{"a", "b"};
+  const std::string* const data{elements.Data()};
+
+  const CowArray<std::string> array{std::move(elements)};
+  EXPECT_EQ(array.Data(), data);
+  EXPECT_EQ(array[1], "b");
+}
+
+// Assignments
+
+TEST(CowArrayTest, CopyAssignment) {
+  const CowArray<int> array{1, 2, 3};
+  CowArray<int> copy{4};
+
+  copy = array;
+  EXPECT_EQ(copy, array);
+  EXPECT_EQ(array.UseCount(), 2);
+
+  copy = copy;
+  EXPECT_EQ(array.UseCount(), 2);
+}
+
+TEST(CowArrayTest, MoveAssignment) {
+  CowArray<int> array{1, 2, 3};
+  const CowArray<int> copy{array};
+  CowArray<int> moved_array{4};
+
+  moved_array = std::move(array);
+  EXPECT_EQ(moved_array, copy);
+  EXPECT_EQ(copy.UseCount(), 2);
+  EXPECT_TRUE(array.Empty());
+}
+
+// Element access
+
+TEST(CowArrayTest, At) {
+  CowArray<int> array{1, 2, 3};
+  const CowArray<int> copy{array};
+
+  array.At(0) = 5;
+  EXPECT_EQ(array.At(0), 5);
+  EXPECT_EQ(copy.At(0), 1);
+  EXPECT_THROW(array.At(3), std::out_of_range);
+  EXPECT_THROW(CowArray<int>{}.At(0), std::out_of_range);
+}
+
+TEST(CowArrayTest, SubscriptOperator) {
+  CowArray<int> array{1, 2, 3};
+  const CowArray<int> copy{array};
+
+  // Reads through a const reference share the buffer.
+  EXPECT_EQ(std::as_const(array)[1], 2);
+  EXPECT_EQ(copy.UseCount(), 2);
+
+  array[1] = 7;
+  EXPECT_EQ(array, (CowArray<int>{1, 7, 3}));
+  EXPECT_EQ(copy, (CowArray<int>{1, 2, 3}));
+  EXPECT_EQ(copy.UseCount(), 1);
+  EXPECT_EQ(array.UseCount(), 1);
+}
+
+TEST(CowArrayTest, FrontBack) {
+  CowArray<int> array{1, 2, 3};
+  const CowArray<int> copy{array};
+
+  array.Front() = 0;
+  array.Back() = 4;
+  EXPECT_EQ(array, (CowArray<int>{0, 2, 4}));
+  EXPECT_EQ(copy.Front(), 1);
+  EXPECT_EQ(copy.Back(), 3);
+}
+
+TEST(CowArrayTest, SubscriptOperator_ReferenceBeforeCopy) {
+  CowArray<int> array{1, 2, 3};
+
+  // A reference taken before the copy must not write into the copy.
+  int& reference{array[0]};
+  const CowArray<int> snapshot{array};
+  EXPECT_NE(snapshot.Data(), std::as_const(array).Data());
+
+  reference = 42;
+  EXPECT_EQ(array[0], 42);
+  EXPECT_EQ(snapshot[0], 1);
+}
+
+// Iterators
+
+TEST(CowArrayTest, Begin) {
+  CowArray<int> array{1, 2, 3};
+  const CowArray<int> copy{array};
+
+  EXPECT_EQ(array.cbegin(), copy.begin());
+  for (int& value : array) {
+    value *= 2;
+  }
+  EXPECT_EQ(array, (CowArray<int>{2, 4, 6}));
+  EXPECT_EQ(copy, (CowArray<int>{1, 2, 3}));
+}
+
+TEST(CowArrayTest, Begin_IteratorBeforeCopy) {
+  CowArray<int> array{1, 2, 3};
+
+  const CowArray<int>::iterator it{array.begin()};
+  const CowArray<int> snapshot{array};
+
+  *it = 42;
+  EXPECT_EQ(snapshot, (CowArray<int>{1, 2, 3}));
+}
+
+// Capacity
+
+TEST(CowArrayTest, Reserve) {
+  CowArray<int> array{1};
+  const CowArray<int> copy{array};
+
+  array.Reserve(10);
+  EXPECT_EQ(array.Capacity(), 10);
+  EXPECT_EQ(copy.Capacity(), 1);
+
+  array.ShrinkToFit();
+  EXPECT_EQ(array.Capacity(), 1);
+  EXPECT_EQ(array, copy);
+}
+
+// Modifiers
+
+TEST(CowArrayTest, Clear) {
+  CowArray<int> array{1, 2, 3};
+  const CowArray<int> copy{array};
+
+  array.Clear();
+  EXPECT_TRUE(array.Empty());
+  EXPECT_EQ(copy.Size(), 3);
+  EXPECT_EQ(copy.UseCount(), 1);
+}
+
+TEST(CowArrayTest, Set) {
+  CowArray<int> array{1, 2, 3};
+  const CowArray<int> copy{array};
+
+  array.Set(0, 5);
+  EXPECT_EQ(array, (CowArray<int>{5, 2, 3}));
+  EXPECT_EQ(copy, (CowArray<int>{1, 2, 3}));
+  EXPECT_THROW(array.Set(3, 0), std::out_of_range);
+
+  // Set does not hand out a reference, so copies still share.
+  const CowArray<int> other_copy{array};
+  EXPECT_EQ(array.UseCount(), 2);
+}
+
+TEST(CowArrayTest, PushBack) {
+  CowArray<std::string> array;
+  for (int i{0}; i < 100; ++i) {
+    array.PushBack(std::to_string(i));
+  }
+  const CowArray<std::string> snapshot{array};
+
+  array.PushBack("100");
+  array.EmplaceBack(3, 'x');
+  EXPECT_EQ(array.Size(), 102);
+  EXPECT_EQ(array.Back(), "xxx");
+  EXPECT_EQ(snapshot.Size(), 100);
+  EXPECT_EQ(snapshot.Back(), "99");
+
+  array.PopBack();
+  EXPECT_EQ(array.Back(), "100");
+}
+
+TEST(CowArrayTest, Resize) {
+  CowArray<int> array{1};
+  const CowArray<int> copy{array};
+
+  array.Resize(3, 5);
+  EXPECT_EQ(array, (CowArray<int>{1, 5, 5}));
+
+  array.Resize(1);
+  EXPECT_EQ(array, copy);
+  EXPECT_EQ(copy.UseCount(), 1);
+}
+
+TEST(CowArrayTest, Swap) {
+  CowArray<int> array{1};
+  CowArray<int> other;
+
+  array.Swap(other);
+  EXPECT_TRUE(array.Empty());
+  EXPECT_EQ(other, CowArray<int>{1});
+}
+
+TEST(CowArrayTest, Snapshot_Threads) {
+  constexpr std::size_t kSize{1 << 16};
+
+  CowArray<std::size_t> array;
+  array.Resize(kSize);
+
+  for (std::size_t round{0}; round < 8; ++round) {
+    const CowArray<std::size_t> snapshot{array};
+    EXPECT_EQ(snapshot.UseCount(), 2);
+    std::thread reader{[snapshot, round]() {
+      for (std::size_t i{0}; i < kSize; ++i) {
+        ASSERT_EQ(snapshot[i], round);
+      }
+    }};
+
+    for (std::size_t i{0}; i < kSize; ++i) {
+      array.Set(i, round + 1);
+    }
+    reader.join();
+  }
+
+  EXPECT_EQ(std::as_const(array).Front(), 8);
+  EXPECT_EQ(array.UseCount(), 1);
+}
+
+// Comparison operators
+
+TEST(CowArrayTest, EqualOperator) {
+  const CowArray<int> array{1, 2, 3};
+  EXPECT_EQ(array, (CowArray<int>{1, 2, 3}));
+  EXPECT_NE(array, (CowArray<int>{1, 2, 4}));
+  EXPECT_NE(array, CowArray<int>{});
+  EXPECT_EQ(CowArray<int>{}, CowArray<int>{std::initializer_list<int>{}});
+}
+
+// Debug
+
+TEST(CowArrayTest, OutputOperator) {
+  const CowArray<int> array{1, 2};
+  const CowArray<int> copy{array};
+
+  std::ostringstream os;
+  os << array;
+  EXPECT_EQ(os.str(), "[1, 2] (2, shared: 2)\n");
+}
@@ -261,7 +261,7 @@ class Deque {
     for (std::size_t i{0}; i < map_capacity_; ++i) {
       allocator.deallocate(map_[i], kBlockSize);
     }
-    delete[] map_;
+    DeallocateMap(map_, map_capacity_);
   }
 
   // Assignments
@@ -363,7 +363,7 @@ class Deque {
                                  kBlockSize};
 
     Allocator allocator;
-    T** const map{new T*[required_blocks]};
+    T** const map{AllocateMap(required_blocks)};
 
     for (std::size_t i{0}; i < required_blocks; ++i) {
       map[i] = allocator.allocate(kBlockSize);
@@ -377,7 +377,7 @@ class Deque {
     for (std::size_t i{0}; i < map_capacity_; ++i) {
       allocator.deallocate(map_[i], kBlockSize);
     }
-    delete[] map_;
+    DeallocateMap(map_, map_capacity_);
 
     map_ = map;
     map_capacity_ = required_blocks;
@@ -622,6 +622,9 @@ class Deque {
   }
 
  private:
+  using MapAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<T*>;
+
   enum class Position { kFront, kBack };
 
   static constexpr std::size_t kBytes{sizeof(T)};
@@ -687,8 +690,20 @@ class Deque {
     update_head_tail();
   }
 
+  // The map of block pointers comes from the same allocator as the blocks.
+  static T** AllocateMap(const std::size_t capacity) {
+    MapAllocator map_allocator;
+    return map_allocator.allocate(capacity);
+  }
+
+  static void DeallocateMap(T** const map, const std::size_t capacity) {
+    if (map == nullptr) return;
+    MapAllocator map_allocator;
+    map_allocator.deallocate(map, capacity);
+  }
+
   void GrowMap(const std::size_t new_capacity) {
-    T** new_map_{new T*[new_capacity]};
+    T** new_map_{AllocateMap(new_capacity)};
     for (std::size_t i{0}; i < map_size_; ++i) {
       new_map_[i] = map_[(map_head_ + i) % map_capacity_];
     }
@@ -698,7 +713,7 @@ class Deque {
       new_map_[i] = allocator.allocate(kBlockSize);
     }
 
-    delete[] map_;
+    DeallocateMap(map_, map_capacity_);
     map_ = new_map_;
     map_capacity_ = new_capacity;
     map_head_ = 0;
@@ -6,6 +6,7 @@
 #include <iostream>
 #include <iterator>
 #include <memory>
+#include <new>
 #include <ostream>
 #include <type_traits>
 #include <utility>
@@ -231,7 +232,7 @@ class DoublyLinkedList {
     Node<T>* node{head_->next};
     while (node != head_) {
       Node<T>* const temp{node->next};
-      delete node;
+      DestroyNode(node);
       node = temp;
     }
 
@@ -253,7 +254,7 @@ class DoublyLinkedList {
 
     Node<T>* node{nullptr};
     for (std::size_t i{0}; i < count; ++i) {
-      node = new Node<T>{value, prev_node};
+      node = CreateNode(value, prev_node);
       prev_node->next = node;
       prev_node = node;
     }
@@ -279,7 +280,7 @@ class DoublyLinkedList {
     Node<T>* node{nullptr};
 
     for (InputIterator it{first}; it != last; ++it) {
-      node = new Node<T>{*it, prev_node};
+      node = CreateNode(*it, prev_node);
       prev_node->next = node;
       prev_node = node;
       ++distance;
@@ -311,7 +312,7 @@ class DoublyLinkedList {
 
     while (node != last.node_) {
       Node<T>* const next_node{node->next};
-      delete node;
+      DestroyNode(node);
       node = next_node;
       ++distance;
     }
@@ -479,6 +480,25 @@ class DoublyLinkedList {
   using NodeAllocator =
       typename std::allocator_traits<Allocator>::template rebind_alloc<Node<T>>;
 
+  template <class... Args>
+  static Node<T>* CreateNode(Args&&... args) {
+    NodeAllocator node_allocator;
+    Node<T>* const node{node_allocator.allocate(1)};
+    try {
+      return ::new (static_cast<void*>(node))
+          Node<T>{std::forward<Args>(args)...};
+    } catch (...) {
+      node_allocator.deallocate(node, 1);
+      throw;
+    }
+  }
+
+  static void DestroyNode(Node<T>* const node) noexcept {
+    NodeAllocator node_allocator;
+    node->~Node<T>();
+    node_allocator.deallocate(node, 1);
+  }
+
   void TakeContent(DoublyLinkedList&& other) noexcept {
     NodeAllocator node_allocator;
     size_ = other.size_;
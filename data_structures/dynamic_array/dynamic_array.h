@@ -3,17 +3,25 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <new>
 #include <ostream>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 
+#include "growth_policy.h"
+#include "has_reallocate.h"
 #include "is_iterator.h"
+#include "is_trivially_relocatable.h"
+#include "simd.h"
+#include "span.h"
 
-template <class T, class Allocator = std::allocator<T>>
+template <class T, class Allocator = std::allocator<T>,
+          class GrowthPolicy = DoublingGrowth>
 class DynamicArray {
  private:
   class Iterator {
@@ -215,6 +223,7 @@ class DynamicArray {
  public:
   using value_type = T;
   using allocator_type = Allocator;
+  using growth_policy = GrowthPolicy;
   using size_type = std::size_t;
   using difference_type = std::ptrdiff_t;
   using reference = value_type&;
@@ -239,6 +248,7 @@ class DynamicArray {
   DynamicArray(const std::initializer_list<T> list) { Insert(cbegin(), list); }
 
   ~DynamicArray() {
+    std::destroy(data_, data_ + size_);
     Allocator allocator;
     allocator.deallocate(data_, capacity_);
   }
@@ -248,10 +258,9 @@ class DynamicArray {
   DynamicArray& operator=(const DynamicArray& other) {
     if (this == &other) return *this;
 
+    Clear();
     Reserve(other.size_);
-    for (std::size_t i{0}; i < other.size_; ++i) {
-      data_[i] = other[i];
-    }
+    std::uninitialized_copy(other.cbegin(), other.cend(), data_);
     size_ = other.size_;
 
     return *this;
@@ -260,6 +269,7 @@ class DynamicArray {
   DynamicArray& operator=(DynamicArray&& other) noexcept {
     if (this == &other) return *this;
 
+    std::destroy(data_, data_ + size_);
     Allocator allocator;
     allocator.deallocate(data_, capacity_);
     TakeContent(std::move(other));
@@ -268,13 +278,9 @@ class DynamicArray {
   }
 
   DynamicArray& operator=(const std::initializer_list<T> list) {
+    Clear();
     Reserve(list.size());
-
-    std::size_t i{0};
-    for (const T& value : list) {
-      data_[i] = value;
-      ++i;
-    }
+    std::uninitialized_copy(list.begin(), list.end(), data_);
     size_ = list.size();
 
     return *this;
@@ -347,9 +353,7 @@ class DynamicArray {
   // Modifiers
 
   void Clear() {
-    Allocator allocator;
-    allocator.deallocate(data_, capacity_);
-    data_ = allocator.allocate(capacity_);
+    std::destroy(data_, data_ + size_);
     size_ = 0;
   }
 
@@ -365,37 +369,26 @@ class DynamicArray {
         static_cast<std::size_t>(std::distance(cbegin(), position))};
     const std::size_t new_size{size_ + count};
 
-    if (new_size > capacity_) {
-      const std::size_t new_capacity{std::max(capacity_ * 2, new_size)};
+    if (new_size > capacity_ && !kReallocates) {
+      const std::size_t new_capacity{
+          GrowthPolicy::NextCapacity(capacity_, new_size, sizeof(T))};
 
       Allocator allocator;
       T* const new_data{allocator.allocate(new_capacity)};
-      std::size_t i{0};
 
-      for (std::size_t old_i{0}; i < index; ++old_i, ++i) {
-        new_data[i] = std::move(data_[old_i]);
-      }
-      for (std::size_t j{0}; j < count; ++j) {
-        new_data[i] = value;
-        ++i;
-      }
-      for (std::size_t old_i{index}; old_i < size_; ++old_i, ++i) {
-        new_data[i] = std::move(data_[old_i]);
-      }
+      std::uninitialized_fill_n(new_data + index, count, value);
+      Relocate(data_, index, new_data);
+      Relocate(data_ + index, size_ - index, new_data + index + count);
 
       allocator.deallocate(data_, capacity_);
       data_ = new_data;
       capacity_ = new_capacity;
     } else {
-      for (std::size_t i{size_ + count - 1}; i > index + count - 1; --i) {
-        std::swap(data_[i - count], data_[i]);
-      }
-
-      std::size_t i{index};
-      for (std::size_t j{0}; j < count; ++j) {
-        data_[i] = value;
-        ++i;
-      }
+      // Copied first, since `value` may be one of the shifted elements.
+      const T copy{value};
+      ReserveForSize(new_size);
+      OpenGap(index, count);
+      std::uninitialized_fill_n(data_ + index, count, copy);
     }
 
     size_ = new_size;
@@ -414,37 +407,24 @@ class DynamicArray {
         static_cast<std::size_t>(std::distance(first, last))};
     const std::size_t new_size{size_ + distance};
 
-    if (new_size > capacity_) {
-      const std::size_t new_capacity{std::max(capacity_ * 2, new_size)};
+    if (new_size > capacity_ && !kReallocates) {
+      const std::size_t new_capacity{
+          GrowthPolicy::NextCapacity(capacity_, new_size, sizeof(T))};
 
       Allocator allocator;
       T* const new_data{allocator.allocate(new_capacity)};
-      std::size_t i{0};
 
-      for (std::size_t old_i{0}; i < index; ++old_i, ++i) {
-        new_data[i] = std::move(data_[old_i]);
-      }
-      for (auto it{first}; it != last; ++it) {
-        new_data[i] = *it;
-        ++i;
-      }
-      for (std::size_t old_i{index}; old_i < size_; ++old_i, ++i) {
-        new_data[i] = std::move(data_[old_i]);
-      }
+      std::uninitialized_copy(first, last, new_data + index);
+      Relocate(data_, index, new_data);
+      Relocate(data_ + index, size_ - index, new_data + index + distance);
 
       allocator.deallocate(data_, capacity_);
       data_ = new_data;
       capacity_ = new_capacity;
     } else {
-      for (std::size_t i{size_ + distance - 1}; i > index + distance - 1; --i) {
-        std::swap(data_[i - distance], data_[i]);
-      }
-
-      std::size_t i{index};
-      for (auto it{first}; it != last; ++it) {
-        data_[i] = *it;
-        ++i;
-      }
+      ReserveForSize(new_size);
+      OpenGap(index, distance);
+      std::uninitialized_copy(first, last, data_ + index);
     }
 
     size_ = new_size;
@@ -456,6 +436,26 @@ class DynamicArray {
     return Insert(position, list.begin(), list.end());
   }
 
+  template <class... Args>
+  iterator Emplace(const_iterator position, Args&&... args) {
+    const std::size_t index{
+        static_cast<std::size_t>(std::distance(cbegin(), position))};
+    if (index == size_) {
+      EmplaceBack(std::forward<Args>(args)...);
+      return iterator(data_, index);
+    }
+
+    // Constructed up front, since `args` may refer to elements of the array.
+    T value(std::forward<Args>(args)...);
+    if (size_ == capacity_) Grow();
+
+    OpenGap(index, 1);
+    ::new (static_cast<void*>(data_ + index)) T(std::move(value));
+    ++size_;
+
+    return iterator(data_, index);
+  }
+
   iterator Erase(const_iterator position) {
     return Erase(position, position + 1);
   }
@@ -471,22 +471,35 @@ class DynamicArray {
         static_cast<std::size_t>(std::distance(cbegin(), first))};
     const std::size_t last_index{first_index + distance};
 
-    for (std::size_t i{first_index}; i < last_index; ++i) {
-      data_[i].~T();
-    }
-
-    for (std::size_t i{first_index}; i + distance < size_; ++i) {
-      data_[i] = std::move(data_[i + distance]);
+    if constexpr (is_trivially_relocatable<T>) {
+      std::destroy(data_ + first_index, data_ + last_index);
+      std::memmove(static_cast<void*>(data_ + first_index),
+                   static_cast<const void*>(data_ + last_index),
+                   (size_ - last_index) * sizeof(T));
+    } else {
+      std::move(data_ + last_index, data_ + size_, data_ + first_index);
+      std::destroy(data_ + size_ - distance, data_ + size_);
     }
     size_ -= distance;
 
-    return last_index == size_ ? end() : iterator(data_, last_index - distance);
+    return iterator(data_, first_index);
   }
 
-  void PushBack(const_reference value) {
-    if (size_ == capacity_) Grow();
-    data_[size_] = value;
-    ++size_;
+  void PushBack(const_reference value) { EmplaceBack(value); }
+
+  void PushBack(T&& value) { EmplaceBack(std::move(value)); }
+
+  template <class... Args>
+  reference EmplaceBack(Args&&... args) {
+    if (size_ == capacity_) {
+      T value(std::forward<Args>(args)...);
+      Grow();
+      ::new (static_cast<void*>(data_ + size_)) T(std::move(value));
+    } else {
+      ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+    }
+
+    return data_[size_++];
   }
 
   void PopBack() {
@@ -494,7 +507,18 @@ class DynamicArray {
     --size_;
   }
 
-  void Resize(const size_type new_size, const_reference value = T()) {
+  void Resize(const size_type new_size) {
+    if (new_size <= size_) {
+      Erase(const_iterator(data_, new_size), cend());
+      return;
+    }
+
+    ReserveForSize(new_size);
+    std::uninitialized_value_construct(data_ + size_, data_ + new_size);
+    size_ = new_size;
+  }
+
+  void Resize(const size_type new_size, const_reference value) {
     if (new_size < size_) {
       Erase(const_iterator(data_, new_size), cend());
     } else {
@@ -502,21 +526,63 @@ class DynamicArray {
     }
   }
 
+  // Like Resize, but new elements are default-initialized, which leaves
+  // trivial types such as bytes of an I/O buffer indeterminate.
+  void ResizeDefaultInit(const size_type new_size) {
+    if (new_size <= size_) {
+      Erase(const_iterator(data_, new_size), cend());
+      return;
+    }
+
+    ReserveForSize(new_size);
+    std::uninitialized_default_construct(data_ + size_, data_ + new_size);
+    size_ = new_size;
+  }
+
+  void ResizeUninitialized(const size_type new_size) {
+    static_assert(std::is_trivially_default_constructible_v<T> &&
+                      std::is_trivially_destructible_v<T>,
+                  "elements must not need construction or destruction");
+
+    ReserveForSize(new_size);
+    size_ = new_size;
+  }
+
+  // Appends `count` uninitialized elements and returns them for writing.
+  Span<T> AppendUninitialized(const size_type count) {
+    static_assert(std::is_trivially_default_constructible_v<T> &&
+                      std::is_trivially_destructible_v<T>,
+                  "elements must not need construction or destruction");
+
+    ReserveForSize(size_ + count);
+    const Span<T> appended{data_ + size_, count};
+    size_ += count;
+    return appended;
+  }
+
   void Swap(DynamicArray& other) noexcept {
     std::swap(data_, other.data_);
     std::swap(capacity_, other.capacity_);
     std::swap(size_, other.size_);
   }
 
+  // Lookup
+
+  iterator Find(const_reference value) {
+    return iterator(data_, SimdFind(data_, size_, value));
+  }
+  const_iterator Find(const_reference value) const {
+    return const_iterator(data_, SimdFind(data_, size_, value));
+  }
+
+  size_type Count(const_reference value) const {
+    return SimdCount(data_, size_, value);
+  }
+
   // Comparison operators
 
   bool operator==(const DynamicArray& other) const noexcept {
-    if (size_ != other.size_) return false;
-
-    for (std::size_t i{0}; i < size_; ++i) {
-      if ((*this)[i] != other[i]) return false;
-    }
-    return true;
+    return size_ == other.size_ && SimdEqual(data_, other.data_, size_);
   }
 
   bool operator!=(const DynamicArray& other) const noexcept {
@@ -547,7 +613,7 @@ class DynamicArray {
   // Debug
 
   friend std::ostream& operator<<(std::ostream& os,
-                                  const DynamicArray<T>& array) noexcept {
+                                  const DynamicArray& array) noexcept {
     os << "[";
     if (array.size_ != 0) {
       for (std::size_t i{0}; i < array.size_ - 1; ++i) {
@@ -562,18 +628,65 @@ class DynamicArray {
  private:
   void ForceReserve(std::size_t new_capacity) {
     Allocator allocator;
-    T* const new_data{allocator.allocate(new_capacity)};
-
-    for (std::size_t i{0}; i < size_; ++i) {
-      new_data[i] = std::move(data_[i]);
+    if constexpr (kReallocates) {
+      data_ = allocator.reallocate(data_, capacity_, new_capacity);
+      capacity_ = new_capacity;
+      return;
     }
 
+    T* const new_data{allocator.allocate(new_capacity)};
+    Relocate(data_, size_, new_data);
+
     allocator.deallocate(data_, capacity_);
     data_ = new_data;
     capacity_ = new_capacity;
   }
 
-  void Grow() { ForceReserve(capacity_ == 0 ? 1 : capacity_ * 2); }
+  // Shifts [index, size) right by `count` within the capacity, moving each
+  // element once, and leaves [index, index + count) uninitialized.
+  void OpenGap(const std::size_t index, const std::size_t count) {
+    if constexpr (is_trivially_relocatable<T>) {
+      std::memmove(static_cast<void*>(data_ + index + count),
+                   static_cast<const void*>(data_ + index),
+                   (size_ - index) * sizeof(T));
+    } else {
+      const std::size_t tail{size_ - index};
+      if (count >= tail) {
+        std::uninitialized_move(data_ + index, data_ + size_,
+                                data_ + index + count);
+        std::destroy(data_ + index, data_ + size_);
+      } else {
+        std::uninitialized_move(data_ + size_ - count, data_ + size_,
+                                data_ + size_);
+        std::move_backward(data_ + index, data_ + size_ - count,
+                           data_ + size_);
+        std::destroy(data_ + index, data_ + index + count);
+      }
+    }
+  }
+
+  // Moves `count` elements into uninitialized memory at `destination` and
+  // ends the lifetime of the originals.
+  static void Relocate(T* const first, const std::size_t count,
+                       T* const destination) {
+    if constexpr (is_trivially_relocatable<T>) {
+      if (count == 0) return;
+      std::memcpy(static_cast<void*>(destination),
+                  static_cast<const void*>(first), count * sizeof(T));
+    } else {
+      std::uninitialized_move(first, first + count, destination);
+      std::destroy(first, first + count);
+    }
+  }
+
+  void ReserveForSize(const std::size_t new_size) {
+    if (new_size <= capacity_) return;
+    ForceReserve(GrowthPolicy::NextCapacity(capacity_, new_size, sizeof(T)));
+  }
+
+  void Grow() {
+    ForceReserve(GrowthPolicy::NextCapacity(capacity_, size_ + 1, sizeof(T)));
+  }
 
   void TakeContent(DynamicArray&& other) noexcept {
     data_ = other.data_;
@@ -584,6 +697,10 @@ class DynamicArray {
     other.size_ = 0;
   }
 
+  // Whether growth can go through the allocator's in-place reallocate.
+  static constexpr bool kReallocates{is_trivially_relocatable<T> &&
+                                     has_reallocate<Allocator>};
+
   T* data_{nullptr};
   std::size_t capacity_{0};
   std::size_t size_{0};
@@ -2,7 +2,14 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <tuple>
 #include <utility>
 
 // Constructors
@@ -328,6 +335,43 @@ TEST(DynamicArrayTest, Capacity) {
   EXPECT_EQ(dynamic_array.Capacity(), 4);
 }
 
+TEST(DynamicArrayTest, Capacity_GrowthPolicy) {
+  auto capacities = [](auto dynamic_array) -> DynamicArray<std::size_t> {
+    DynamicArray<std::size_t> capacities;
+    for (int i{0}; i < 40; ++i) {
+      dynamic_array.PushBack(i);
+      if (capacities.Empty() || capacities.Back() != dynamic_array.Capacity())
+        capacities.PushBack(dynamic_array.Capacity());
+    }
+    return capacities;
+  };
+
+  EXPECT_EQ(
+      capacities(DynamicArray<int, std::allocator<int>, DoublingGrowth>{}),
+      (DynamicArray<std::size_t>{1, 2, 4, 8, 16, 32, 64}));
+  EXPECT_EQ(
+      capacities(DynamicArray<int, std::allocator<int>, OneAndHalfGrowth>{}),
+      (DynamicArray<std::size_t>{1, 2, 3, 4, 6, 9, 13, 19, 28, 42}));
+  EXPECT_EQ(
+      capacities(DynamicArray<int, std::allocator<int>, SizeClassGrowth>{}),
+      (DynamicArray<std::size_t>{4, 6, 10, 16, 24, 40}));
+  EXPECT_EQ(
+      capacities(
+          DynamicArray<int, std::allocator<int>, FixedChunkGrowth<16>>{}),
+      (DynamicArray<std::size_t>{16, 32, 48}));
+}
+
+TEST(DynamicArrayTest, Insert_GrowthPolicy) {
+  DynamicArray<int, std::allocator<int>, FixedChunkGrowth<8>> dynamic_array;
+
+  dynamic_array.Insert(dynamic_array.cend(), 10, 1);
+  EXPECT_EQ(dynamic_array.Capacity(), 16);
+
+  dynamic_array.Insert(dynamic_array.cbegin(), {2, 3, 4, 5, 6, 7, 8});
+  EXPECT_EQ(dynamic_array.Capacity(), 24);
+  EXPECT_EQ(dynamic_array.Front(), 2);
+}
+
 TEST(DynamicArrayTest, ShrinkToFit) {
   DynamicArray<int> dynamic_array;
   dynamic_array.Reserve(10);
@@ -392,6 +436,33 @@ TEST(DynamicArrayTest, Insert_Value) {
   EXPECT_EQ(dynamic_array, (DynamicArray{5, 2, 4, 6, 1, 3, 7}));
 }
 
+TEST(DynamicArrayTest, Insert_NonTrivial) {
+  const std::string long_string(64, 'x');
+  DynamicArray<std::string> dynamic_array{"one", long_string};
+
+  dynamic_array.Insert(dynamic_array.cbegin() + 1, 2, "two");
+  EXPECT_EQ(dynamic_array,
+            (DynamicArray<std::string>{"one", "two", "two", long_string}));
+
+  dynamic_array.Reserve(100);
+  EXPECT_EQ(dynamic_array.Back(), long_string);
+}
+
+TEST(DynamicArrayTest, Insert_NonTrivialInPlace) {
+  DynamicArray<std::string> dynamic_array{"a", "b", "c", "d"};
+  dynamic_array.Reserve(16);
+
+  dynamic_array.Insert(dynamic_array.cbegin() + 1, 2, dynamic_array[3]);
+  EXPECT_EQ(dynamic_array,
+            (DynamicArray<std::string>{"a", "d", "d", "b", "c", "d"}));
+
+  const std::string values[]{"x", "y", "z"};
+  dynamic_array.Insert(dynamic_array.cbegin() + 5, values, values + 3);
+  EXPECT_EQ(dynamic_array, (DynamicArray<std::string>{"a", "d", "d", "b", "c",
+                                                      "x", "y", "z", "d"}));
+  EXPECT_EQ(dynamic_array.Capacity(), 16);
+}
+
 TEST(DynamicArrayTest, Insert_ValueCount) {
   DynamicArray<int> dynamic_array;
   auto inserted{dynamic_array.end()};
@@ -553,6 +624,18 @@ TEST(DynamicArrayTest, Erase_Element) {
   EXPECT_TRUE(dynamic_array.Empty());
 }
 
+TEST(DynamicArrayTest, Erase_NonTrivial) {
+  DynamicArray<std::string> dynamic_array{"zero", "one", "two", "three"};
+
+  auto next{dynamic_array.Erase(dynamic_array.cbegin() + 1)};
+  EXPECT_EQ(*next, "two");
+  EXPECT_EQ(dynamic_array, (DynamicArray<std::string>{"zero", "two", "three"}));
+
+  next = dynamic_array.Erase(dynamic_array.cbegin() + 1, dynamic_array.cend());
+  EXPECT_EQ(next, dynamic_array.end());
+  EXPECT_EQ(dynamic_array, (DynamicArray<std::string>{"zero"}));
+}
+
 TEST(DynamicArrayTest, Erase_Range) {
   DynamicArray<int> dynamic_array{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
   auto next{dynamic_array.end()};
@@ -585,6 +668,45 @@ TEST(DynamicArrayTest, PushBack) {
   EXPECT_EQ(dynamic_array.Back(), 1);
 }
 
+TEST(DynamicArrayTest, PushBack_Rvalue) {
+  DynamicArray<std::unique_ptr<int>> dynamic_array;
+
+  for (int i{0}; i < 5; ++i) {
+    dynamic_array.PushBack(std::make_unique<int>(i));
+  }
+  EXPECT_EQ(dynamic_array.Size(), 5);
+  EXPECT_EQ(*dynamic_array.Back(), 4);
+}
+
+TEST(DynamicArrayTest, EmplaceBack) {
+  DynamicArray<std::pair<std::string, int>> dynamic_array;
+
+  auto& emplaced{dynamic_array.EmplaceBack("one", 1)};
+  EXPECT_EQ(emplaced.first, "one");
+
+  dynamic_array.EmplaceBack(std::piecewise_construct,
+                             std::forward_as_tuple(3, 'x'), std::tuple<>{});
+  dynamic_array.EmplaceBack(dynamic_array.Front());
+  EXPECT_EQ(dynamic_array.Size(), 3);
+  EXPECT_EQ(dynamic_array[1], std::make_pair(std::string("xxx"), 0));
+  EXPECT_EQ(dynamic_array[2], std::make_pair(std::string("one"), 1));
+}
+
+TEST(DynamicArrayTest, Emplace) {
+  DynamicArray<std::string> dynamic_array{"a", "d"};
+
+  auto emplaced{dynamic_array.Emplace(dynamic_array.cbegin() + 1, 2, 'b')};
+  EXPECT_EQ(*emplaced, "bb");
+
+  emplaced = dynamic_array.Emplace(dynamic_array.cbegin(), dynamic_array[2]);
+  EXPECT_EQ(*emplaced, "d");
+
+  emplaced = dynamic_array.Emplace(dynamic_array.cend(), "e");
+  EXPECT_EQ(*emplaced, "e");
+  EXPECT_EQ(dynamic_array,
+            (DynamicArray<std::string>{"d", "a", "bb", "d", "e"}));
+}
+
 TEST(DynamicArrayTest, PopBack) {
   DynamicArray<int> dynamic_array{1, 2, 3};
 
@@ -609,6 +731,44 @@ TEST(DynamicArrayTest, Resize) {
   EXPECT_EQ(dynamic_array, (DynamicArray{0, 0, 1}));
 }
 
+TEST(DynamicArrayTest, ResizeDefaultInit) {
+  DynamicArray<std::string> dynamic_array{"one"};
+
+  dynamic_array.ResizeDefaultInit(3);
+  EXPECT_EQ(dynamic_array, (DynamicArray<std::string>{"one", "", ""}));
+
+  dynamic_array.ResizeDefaultInit(1);
+  EXPECT_EQ(dynamic_array, (DynamicArray<std::string>{"one"}));
+}
+
+TEST(DynamicArrayTest, ResizeUninitialized) {
+  DynamicArray<char> dynamic_array{'a'};
+
+  dynamic_array.ResizeUninitialized(4);
+  EXPECT_EQ(dynamic_array.Size(), 4);
+  EXPECT_EQ(dynamic_array.Front(), 'a');
+  std::memcpy(dynamic_array.Data() + 1, "bcd", 3);
+  EXPECT_EQ(dynamic_array, (DynamicArray<char>{'a', 'b', 'c', 'd'}));
+
+  dynamic_array.ResizeUninitialized(2);
+  EXPECT_EQ(dynamic_array, (DynamicArray<char>{'a', 'b'}));
+}
+
+TEST(DynamicArrayTest, AppendUninitialized) {
+  DynamicArray<int> dynamic_array{1};
+
+  const Span<int> appended{dynamic_array.AppendUninitialized(3)};
+  EXPECT_EQ(appended.Size(), 3);
+  EXPECT_EQ(appended.Data(), dynamic_array.Data() + 1);
+  for (std::size_t i{0}; i < appended.Size(); ++i) {
+    appended[i] = static_cast<int>(i) + 2;
+  }
+  EXPECT_EQ(dynamic_array, (DynamicArray<int>{1, 2, 3, 4}));
+
+  EXPECT_TRUE(dynamic_array.AppendUninitialized(0).Empty());
+  EXPECT_EQ(dynamic_array.Size(), 4);
+}
+
 TEST(DynamicArrayTest, Swap) {
   DynamicArray<int> a{1, 2, 3};
   DynamicArray<int> b{4, 5, 6};
@@ -620,6 +780,40 @@ TEST(DynamicArrayTest, Swap) {
   EXPECT_EQ(b, expected_b);
 }
 
+// Lookup
+
+TEST(DynamicArrayTest, Find) {
+  DynamicArray<std::uint8_t> dynamic_array;
+  for (int i{0}; i < 100; ++i) {
+    dynamic_array.PushBack(static_cast<std::uint8_t>(i % 50));
+  }
+
+  EXPECT_EQ(dynamic_array.Find(49) - dynamic_array.begin(), 49);
+  EXPECT_EQ(dynamic_array.Find(50), dynamic_array.end());
+
+  *dynamic_array.Find(49) = 50;
+  EXPECT_EQ(std::as_const(dynamic_array).Find(49) - dynamic_array.cbegin(),
+            99);
+}
+
+TEST(DynamicArrayTest, Find_NonArithmetic) {
+  const DynamicArray<std::string> dynamic_array{"a", "b", "c"};
+  EXPECT_EQ(*dynamic_array.Find("b"), "b");
+  EXPECT_EQ(dynamic_array.Find("d"), dynamic_array.cend());
+}
+
+TEST(DynamicArrayTest, Count) {
+  DynamicArray<double> dynamic_array;
+  for (int i{0}; i < 50; ++i) {
+    dynamic_array.PushBack(i % 2 == 0 ? 0.0 : -0.0);
+  }
+  dynamic_array.PushBack(std::nan(""));
+
+  EXPECT_EQ(dynamic_array.Count(0.0), 50);
+  EXPECT_EQ(dynamic_array.Count(std::nan("")), 0);
+  EXPECT_EQ(DynamicArray<double>{}.Count(0.0), 0);
+}
+
 // Comparison operators
 
 TEST(DynamicArrayTest, EqualOperator) {
@@ -628,6 +822,43 @@ TEST(DynamicArrayTest, EqualOperator) {
   EXPECT_EQ(a, b);
 }
 
+TEST(DynamicArrayTest, EqualOperator_Vectorized) {
+  for (std::size_t size{1}; size <= 70; ++size) {
+    DynamicArray<std::int16_t> a;
+    a.Resize(size, 7);
+    EXPECT_EQ(a, a);
+
+    for (std::size_t i{0}; i < size; ++i) {
+      DynamicArray<std::int16_t> b{a};
+      b[i] = 8;
+      ASSERT_NE(a, b) << size << ", " << i;
+    }
+  }
+}
+
+TEST(DynamicArrayTest, SimdLexicographicalCompare) {
+  DynamicArray<int> a;
+  a.Resize(40, 1);
+  DynamicArray<int> b{a};
+  b[37] = 2;
+
+  EXPECT_TRUE(SimdLexicographicalCompare(a.Data(), a.Size(), b.Data(),
+                                         b.Size()));
+  EXPECT_FALSE(SimdLexicographicalCompare(b.Data(), b.Size(), a.Data(),
+                                          a.Size()));
+  EXPECT_TRUE(SimdLexicographicalCompare(a.Data(), 39, a.Data(), 40));
+  EXPECT_FALSE(SimdLexicographicalCompare(a.Data(), 40, a.Data(), 40));
+
+  DynamicArray<float> c;
+  c.Resize(20, 1.0f);
+  DynamicArray<float> d{c};
+  c[3] = std::nanf("");
+  d[3] = std::nanf("");
+  d[12] = 0.5f;
+  EXPECT_TRUE(SimdLexicographicalCompare(d.Data(), d.Size(), c.Data(),
+                                         c.Size()));
+}
+
 TEST(DynamicArrayTest, NotEqualOperator) {
   const DynamicArray<int> a{1, 2, 3};
   const DynamicArray<int> b{4, 5, 6};
@@ -0,0 +1,348 @@
+#ifndef CPP_ALGORITHMS_DATA_STRUCTURES_DYNAMIC_BITSET_DYNAMIC_BITSET_H_
+#define CPP_ALGORITHMS_DATA_STRUCTURES_DYNAMIC_BITSET_DYNAMIC_BITSET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+#include "bits.h"
+#include "dynamic_array.h"
+#include "simd.h"
+
+// Growable sequence of bits packed 64 to a word. Bits past Size() in the last
+// word are kept zero so that counting and comparisons can work on whole
+// words. Bulk operations and counting go through the SIMD kernels.
+//
+// BuildRankIndex() stores the number of set bits before every block of
+// kRankBlockWords words, which makes Rank constant time and lets Select
+// binary search the blocks. Any modification drops the index.
+class DynamicBitset {
+ public:
+  using size_type = std::size_t;
+  using word_type = std::uint64_t;
+
+  static constexpr std::size_t kWordBits{64};
+  static constexpr std::size_t kRankBlockWords{8};
+
+  // Constructors
+
+  DynamicBitset() noexcept = default;
+
+  explicit DynamicBitset(const size_type size, const bool value = false) {
+    Resize(size, value);
+  }
+
+  DynamicBitset(const DynamicBitset& other) = default;
+
+  DynamicBitset(DynamicBitset&& other) noexcept { Swap(other); }
+
+  DynamicBitset(const std::initializer_list<bool> list) {
+    Reserve(list.size());
+    for (const bool value : list) {
+      PushBack(value);
+    }
+  }
+
+  // Assignments
+
+  DynamicBitset& operator=(const DynamicBitset& other) = default;
+
+  DynamicBitset& operator=(DynamicBitset&& other) noexcept {
+    if (this == &other) return *this;
+
+    Clear();
+    Swap(other);
+
+    return *this;
+  }
+
+  // Element access
+
+  bool At(const size_type index) const {
+    if (index >= size_) throw std::out_of_range("index out of bounds");
+    return Test(index);
+  }
+
+  bool operator[](const size_type index) const { return Test(index); }
+
+  bool Test(const size_type index) const {
+    return (words_[index / kWordBits] >> (index % kWordBits)) & 1;
+  }
+
+  const DynamicArray<word_type>& Words() const noexcept { return words_; }
+
+  // Capacity
+
+  bool Empty() const noexcept { return size_ == 0; }
+
+  size_type Size() const noexcept { return size_; }
+
+  void Reserve(const size_type new_capacity) {
+    words_.Reserve(WordsFor(new_capacity));
+  }
+
+  void ShrinkToFit() {
+    words_.ShrinkToFit();
+    rank_.ShrinkToFit();
+  }
+
+  // Modifiers
+
+  void Clear() noexcept {
+    words_.Clear();
+    rank_.Clear();
+    size_ = 0;
+  }
+
+  void PushBack(const bool value) {
+    if (size_ % kWordBits == 0) words_.PushBack(0);
+    ++size_;
+    Set(size_ - 1, value);
+  }
+
+  void PopBack() { Resize(size_ - 1); }
+
+  void Resize(const size_type new_size, const bool value = false) {
+    rank_.Clear();
+    if (value && new_size > size_ && size_ % kWordBits != 0) {
+      words_.Back() |= ~word_type{0} << (size_ % kWordBits);
+    }
+
+    words_.Resize(WordsFor(new_size), value ? ~word_type{0} : 0);
+    size_ = new_size;
+    ClearUnusedBits();
+  }
+
+  void Set(const size_type index) {
+    rank_.Clear();
+    words_[index / kWordBits] |= Mask(index);
+  }
+
+  void Set(const size_type index, const bool value) {
+    value ? Set(index) : Reset(index);
+  }
+
+  void Reset(const size_type index) {
+    rank_.Clear();
+    words_[index / kWordBits] &= ~Mask(index);
+  }
+
+  void Flip(const size_type index) {
+    rank_.Clear();
+    words_[index / kWordBits] ^= Mask(index);
+  }
+
+  void SetAll() {
+    rank_.Clear();
+    SimdFill(words_.Data(), words_.Size(), ~word_type{0});
+    ClearUnusedBits();
+  }
+
+  void ResetAll() {
+    rank_.Clear();
+    SimdFill(words_.Data(), words_.Size(), word_type{0});
+  }
+
+  void FlipAll() {
+    rank_.Clear();
+    for (word_type& word : words_) {
+      word = ~word;
+    }
+    ClearUnusedBits();
+  }
+
+  void Swap(DynamicBitset& other) noexcept {
+    words_.Swap(other.words_);
+    rank_.Swap(other.rank_);
+    std::swap(size_, other.size_);
+  }
+
+  // Bitwise operators. Both bitsets must have the same size.
+
+  DynamicBitset& operator&=(const DynamicBitset& other) {
+    return Combine<BitwiseOp::kAnd>(other);
+  }
+
+  DynamicBitset& operator|=(const DynamicBitset& other) {
+    return Combine<BitwiseOp::kOr>(other);
+  }
+
+  DynamicBitset& operator^=(const DynamicBitset& other) {
+    return Combine<BitwiseOp::kXor>(other);
+  }
+
+  // Clears the bits that are set in `other`.
+  DynamicBitset& AndNot(const DynamicBitset& other) {
+    return Combine<BitwiseOp::kAndNot>(other);
+  }
+
+  friend DynamicBitset operator&(DynamicBitset a, const DynamicBitset& b) {
+    return a &= b;
+  }
+
+  friend DynamicBitset operator|(DynamicBitset a, const DynamicBitset& b) {
+    return a |= b;
+  }
+
+  friend DynamicBitset operator^(DynamicBitset a, const DynamicBitset& b) {
+    return a ^= b;
+  }
+
+  // Lookup
+
+  // Number of set bits.
+  size_type Count() const noexcept {
+    return SimdPopCount(words_.Data(), words_.Size());
+  }
+
+  bool All() const noexcept { return Count() == size_; }
+
+  bool Any() const noexcept { return FindFirst() != size_; }
+
+  bool None() const noexcept { return !Any(); }
+
+  // Position of the first set bit, or Size() if there is none.
+  size_type FindFirst() const noexcept { return FindFrom(0); }
+
+  // Position of the first set bit after `position`, or Size().
+  size_type FindNext(const size_type position) const noexcept {
+    return FindFrom(position + 1);
+  }
+
+  // Rank and select
+
+  void BuildRankIndex() {
+    rank_.Clear();
+    rank_.Reserve(words_.Size() / kRankBlockWords + 1);
+
+    word_type ones{0};
+    for (std::size_t i{0}; i < words_.Size(); ++i) {
+      if (i % kRankBlockWords == 0) rank_.PushBack(ones);
+      ones += PopCount(words_[i]);
+    }
+    if (words_.Size() % kRankBlockWords == 0) rank_.PushBack(ones);
+  }
+
+  bool HasRankIndex() const noexcept { return !rank_.Empty(); }
+
+  // Number of set bits before `position`, for `position` up to Size(). Takes
+  // at most kRankBlockWords word counts with the index and a linear count
+  // without it.
+  size_type Rank(const size_type position) const {
+    const std::size_t word{position / kWordBits};
+
+    std::size_t ones;
+    if (HasRankIndex()) {
+      const std::size_t block{word / kRankBlockWords};
+      ones = rank_[block];
+      for (std::size_t i{block * kRankBlockWords}; i < word; ++i) {
+        ones += PopCount(words_[i]);
+      }
+    } else {
+      ones = SimdPopCount(words_.Data(), word);
+    }
+
+    if (position % kWordBits != 0) {
+      ones += PopCount(words_[word] & (Mask(position) - 1));
+    }
+    return ones;
+  }
+
+  // Position of the set bit with rank `rank` (the first one has rank 0), or
+  // Size() if fewer bits are set.
+  size_type Select(size_type rank) const {
+    std::size_t word{0};
+    if (HasRankIndex()) {
+      const auto block{std::upper_bound(rank_.begin(), rank_.end(), rank) -
+                       rank_.begin() - 1};
+      word = static_cast<std::size_t>(block) * kRankBlockWords;
+      rank -= rank_[static_cast<std::size_t>(block)];
+    }
+
+    for (; word < words_.Size(); ++word) {
+      const std::size_t ones{PopCount(words_[word])};
+      if (rank < ones) {
+        return word * kWordBits + SelectInWord(words_[word], rank);
+      }
+      rank -= ones;
+    }
+    return size_;
+  }
+
+  // Comparison operators
+
+  bool operator==(const DynamicBitset& other) const noexcept {
+    return size_ == other.size_ && words_ == other.words_;
+  }
+
+  bool operator!=(const DynamicBitset& other) const noexcept {
+    return !(*this == other);
+  }
+
+  // Debug
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const DynamicBitset& bitset) noexcept {
+    os << "[";
+    for (std::size_t i{0}; i < bitset.size_; ++i) {
+      if (i != 0) os << ", ";
+      os << bitset[i];
+    }
+    os << "] (" << bitset.size_ << ")\n";
+    return os;
+  }
+
+ private:
+  static constexpr std::size_t WordsFor(const std::size_t bits) noexcept {
+    return (bits + kWordBits - 1) / kWordBits;
+  }
+
+  static constexpr word_type Mask(const std::size_t index) noexcept {
+    return word_type{1} << (index % kWordBits);
+  }
+
+  // Position of the set bit of `word` with rank `rank`.
+  static std::size_t SelectInWord(word_type word, std::size_t rank) noexcept {
+    for (; rank != 0; --rank) {
+      word &= word - 1;
+    }
+    return LowestBit(word);
+  }
+
+  template <BitwiseOp Op>
+  DynamicBitset& Combine(const DynamicBitset& other) {
+    if (size_ != other.size_) {
+      throw std::invalid_argument("bitsets must have the same size");
+    }
+
+    rank_.Clear();
+    SimdBitwise<Op>(words_.Data(), other.words_.Data(), words_.Size());
+    return *this;
+  }
+
+  size_type FindFrom(const size_type position) const noexcept {
+    if (position >= size_) return size_;
+
+    std::size_t word{position / kWordBits};
+    word_type bits{words_[word] & ~(Mask(position) - 1)};
+    while (bits == 0) {
+      if (++word == words_.Size()) return size_;
+      bits = words_[word];
+    }
+    return word * kWordBits + LowestBit(bits);
+  }
+
+  void ClearUnusedBits() noexcept {
+    if (size_ % kWordBits != 0) words_.Back() &= Mask(size_) - 1;
+  }
+
+  DynamicArray<word_type> words_;
+  DynamicArray<word_type> rank_;
+  std::size_t size_{0};
+};
+
+#endif  // CPP_ALGORITHMS_DATA_STRUCTURES_DYNAMIC_BITSET_DYNAMIC_BITSET_H_
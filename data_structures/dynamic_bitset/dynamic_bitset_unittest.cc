@@ -0,0 +1,219 @@
+#include "dynamic_bitset.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Bits set with the given probability, mirrored in a vector<bool>.
+std::pair<DynamicBitset, std::vector<bool>> RandomBits(const std::size_t size,
+                                                       const double density,
+                                                       const unsigned seed) {
+  std::mt19937 generator{seed};
+  std::bernoulli_distribution distribution{density};
+
+  DynamicBitset bitset(size);
+  std::vector<bool> expected(size);
+  for (std::size_t i{0}; i < size; ++i) {
+    expected[i] = distribution(generator);
+    bitset.Set(i, expected[i]);
+  }
+  return {std::move(bitset), std::move(expected)};
+}
+
+// Constructors
+
+TEST(DynamicBitsetTest, Constructor) {
+  const DynamicBitset bitset;
+  EXPECT_TRUE(bitset.Empty());
+  EXPECT_EQ(bitset.Count(), 0);
+  EXPECT_EQ(bitset.FindFirst(), 0);
+}
+
+TEST(DynamicBitsetTest, SizeConstructor) {
+  const DynamicBitset zeros(100);
+  EXPECT_EQ(zeros.Size(), 100);
+  EXPECT_TRUE(zeros.None());
+
+  const DynamicBitset ones(100, true);
+  EXPECT_EQ(ones.Count(), 100);
+  EXPECT_TRUE(ones.All());
+  EXPECT_EQ(ones.Words().Size(), 2);
+  EXPECT_EQ(ones.Words()[1], (std::uint64_t{1} << 36) - 1);
+}
+
+TEST(DynamicBitsetTest, MoveConstructor) {
+  DynamicBitset bitset{true, false, true};
+  const DynamicBitset moved_bitset{std::move(bitset)};
+  EXPECT_EQ(moved_bitset, (DynamicBitset{true, false, true}));
+  EXPECT_TRUE(bitset.Empty());
+}
+
+TEST(DynamicBitsetTest, InitializerListConstructor) {
+  const DynamicBitset bitset{true, false, true};
+  EXPECT_EQ(bitset.Size(), 3);
+  EXPECT_TRUE(bitset[0]);
+  EXPECT_FALSE(bitset[1]);
+  EXPECT_TRUE(bitset[2]);
+}
+
+// Element access
+
+TEST(DynamicBitsetTest, At) {
+  const DynamicBitset bitset{false, true};
+  EXPECT_TRUE(bitset.At(1));
+  EXPECT_THROW(bitset.At(2), std::out_of_range);
+}
+
+// Modifiers
+
+TEST(DynamicBitsetTest, PushBack) {
+  DynamicBitset bitset;
+  for (std::size_t i{0}; i < 200; ++i) {
+    bitset.PushBack(i % 3 == 0);
+  }
+
+  EXPECT_EQ(bitset.Size(), 200);
+  EXPECT_EQ(bitset.Count(), 67);
+
+  bitset.PopBack();
+  bitset.PopBack();
+  EXPECT_EQ(bitset.Count(), 66);
+}
+
+TEST(DynamicBitsetTest, Resize) {
+  DynamicBitset bitset{true, false};
+
+  bitset.Resize(130, true);
+  EXPECT_EQ(bitset.Count(), 129);
+  EXPECT_FALSE(bitset[1]);
+
+  bitset.Resize(70);
+  EXPECT_EQ(bitset.Count(), 69);
+
+  bitset.Resize(140);
+  EXPECT_EQ(bitset.Count(), 69);
+}
+
+TEST(DynamicBitsetTest, SetResetFlip) {
+  DynamicBitset bitset(70);
+
+  bitset.Set(3);
+  bitset.Set(69);
+  bitset.Flip(4);
+  bitset.Flip(3);
+  EXPECT_EQ(bitset.Count(), 2);
+  EXPECT_TRUE(bitset.Test(4));
+  EXPECT_TRUE(bitset.Test(69));
+
+  bitset.Reset(69);
+  EXPECT_FALSE(bitset.Test(69));
+
+  bitset.FlipAll();
+  EXPECT_EQ(bitset.Count(), 69);
+  bitset.SetAll();
+  EXPECT_TRUE(bitset.All());
+  bitset.ResetAll();
+  EXPECT_TRUE(bitset.None());
+}
+
+// Bitwise operators
+
+TEST(DynamicBitsetTest, BitwiseOperators) {
+  constexpr std::size_t kSize{1000};
+  const auto [a, expected_a] = RandomBits(kSize, 0.5, 1);
+  const auto [b, expected_b] = RandomBits(kSize, 0.5, 2);
+
+  const DynamicBitset both{a & b};
+  const DynamicBitset either{a | b};
+  const DynamicBitset one{a ^ b};
+  DynamicBitset only_a{a};
+  only_a.AndNot(b);
+
+  for (std::size_t i{0}; i < kSize; ++i) {
+    EXPECT_EQ(both[i], expected_a[i] && expected_b[i]);
+    EXPECT_EQ(either[i], expected_a[i] || expected_b[i]);
+    EXPECT_EQ(one[i], expected_a[i] != expected_b[i]);
+    EXPECT_EQ(only_a[i], expected_a[i] && !expected_b[i]);
+  }
+
+  DynamicBitset shorter(kSize - 1);
+  EXPECT_THROW(shorter |= a, std::invalid_argument);
+}
+
+// Lookup
+
+TEST(DynamicBitsetTest, Count) {
+  for (const std::size_t size : {0, 1, 63, 64, 65, 255, 256, 1000}) {
+    const auto [bitset, expected] = RandomBits(size, 0.3, 3);
+
+    std::size_t count{0};
+    for (const bool bit : expected) {
+      count += bit;
+    }
+    EXPECT_EQ(bitset.Count(), count);
+  }
+}
+
+TEST(DynamicBitsetTest, FindNext) {
+  DynamicBitset bitset(300);
+  bitset.Set(5);
+  bitset.Set(64);
+  bitset.Set(299);
+
+  EXPECT_EQ(bitset.FindFirst(), 5);
+  EXPECT_EQ(bitset.FindNext(5), 64);
+  EXPECT_EQ(bitset.FindNext(64), 299);
+  EXPECT_EQ(bitset.FindNext(299), 300);
+}
+
+// Rank and select
+
+TEST(DynamicBitsetTest, Rank) {
+  auto [bitset, expected] = RandomBits(5000, 0.4, 4);
+
+  for (const bool indexed : {false, true}) {
+    if (indexed) bitset.BuildRankIndex();
+    EXPECT_EQ(bitset.HasRankIndex(), indexed);
+
+    std::size_t rank{0};
+    for (std::size_t i{0}; i <= expected.size(); ++i) {
+      EXPECT_EQ(bitset.Rank(i), rank);
+      if (i < expected.size()) rank += expected[i];
+    }
+  }
+
+  bitset.Set(0);
+  EXPECT_FALSE(bitset.HasRankIndex());
+}
+
+TEST(DynamicBitsetTest, Select) {
+  auto [bitset, expected] = RandomBits(4096, 0.1, 5);
+
+  std::vector<std::size_t> positions;
+  for (std::size_t i{0}; i < expected.size(); ++i) {
+    if (expected[i]) positions.push_back(i);
+  }
+
+  for (const bool indexed : {false, true}) {
+    if (indexed) bitset.BuildRankIndex();
+
+    for (std::size_t rank{0}; rank < positions.size(); ++rank) {
+      EXPECT_EQ(bitset.Select(rank), positions[rank]);
+    }
+    EXPECT_EQ(bitset.Select(positions.size()), bitset.Size());
+  }
+}
+
+// Debug
+
+TEST(DynamicBitsetTest, OutputOperator) {
+  std::ostringstream os;
+  os << DynamicBitset{true, false, true};
+  EXPECT_EQ(os.str(), "[1, 0, 1] (3)\n");
+}
@@ -0,0 +1,424 @@
+#ifndef CPP_ALGORITHMS_DATA_STRUCTURES_FLAT_MAP_FLAT_MAP_H_
+#define CPP_ALGORITHMS_DATA_STRUCTURES_FLAT_MAP_FLAT_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "branchless_search.h"
+#include "dynamic_array.h"
+#include "is_iterator.h"
+
+// Ordered map stored as two parallel sorted arrays of keys and values, so
+// lookups binary search a dense array of keys only and iteration is a linear
+// scan. Single inserts and erases shift the tail and are linear; bulk inserts
+// merge the new entries in one pass instead.
+template <class Key, class T, class Compare = std::less<Key>>
+class FlatMap {
+ private:
+  // Dereferences to a pair of references into the key and value arrays.
+  template <class Mapped>
+  class BasicIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::pair<Key, T>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const Key&, Mapped&>;
+
+    struct pointer {
+      const reference* operator->() const noexcept { return &pair; }
+
+      reference pair;
+    };
+
+    BasicIterator() noexcept = default;
+
+    BasicIterator(const Key* const key, Mapped* const value) noexcept
+        : key_{key}, value_{value} {}
+
+    // Iterators convert to const iterators.
+    template <class Other,
+              class = std::enable_if_t<std::is_same_v<const Other, Mapped> &&
+                                       !std::is_same_v<Other, Mapped>>>
+    BasicIterator(const BasicIterator<Other>& other) noexcept
+        : key_{other.key_}, value_{other.value_} {}
+
+    reference operator*() const noexcept { return {*key_, *value_}; }
+
+    pointer operator->() const noexcept { return {**this}; }
+
+    reference operator[](const difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    BasicIterator& operator++() noexcept {
+      ++key_;
+      ++value_;
+      return *this;
+    }
+
+    BasicIterator operator++(int) noexcept {
+      BasicIterator temp{*this};
+      ++(*this);
+      return temp;
+    }
+
+    BasicIterator& operator--() noexcept {
+      --key_;
+      --value_;
+      return *this;
+    }
+
+    BasicIterator operator--(int) noexcept {
+      BasicIterator temp{*this};
+      --(*this);
+      return temp;
+    }
+
+    BasicIterator& operator+=(const difference_type n) noexcept {
+      key_ += n;
+      value_ += n;
+      return *this;
+    }
+
+    BasicIterator& operator-=(const difference_type n) noexcept {
+      return *this += -n;
+    }
+
+    BasicIterator operator+(const difference_type n) const noexcept {
+      BasicIterator temp{*this};
+      return temp += n;
+    }
+
+    BasicIterator operator-(const difference_type n) const noexcept {
+      BasicIterator temp{*this};
+      return temp -= n;
+    }
+
+    difference_type operator-(const BasicIterator& other) const noexcept {
+      return key_ - other.key_;
+    }
+
+    bool operator==(const BasicIterator& other) const noexcept {
+      return key_ == other.key_;
+    }
+
+    bool operator!=(const BasicIterator& other) const noexcept {
+      return !(*this == other);
+    }
+
+    bool operator<(const BasicIterator& other) const noexcept {
+      return key_ < other.key_;
+    }
+
+   private:
+    friend class FlatMap;
+    template <class>
+    friend class BasicIterator;
+
+    const Key* key_{nullptr};
+    Mapped* value_{nullptr};
+  };
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using key_compare = Compare;
+  using reference = std::pair<const Key&, T&>;
+  using const_reference = std::pair<const Key&, const T&>;
+  using iterator = BasicIterator<T>;
+  using const_iterator = BasicIterator<const T>;
+
+  // Constructors
+
+  FlatMap() noexcept = default;
+
+  FlatMap(const FlatMap& other) = default;
+
+  FlatMap(FlatMap&& other) noexcept { Swap(other); }
+
+  FlatMap(const std::initializer_list<value_type> list) {
+    InsertUnsorted(list.begin(), list.end());
+  }
+
+  // Assignments
+
+  FlatMap& operator=(const FlatMap& other) = default;
+
+  FlatMap& operator=(FlatMap&& other) noexcept {
+    if (this == &other) return *this;
+
+    Clear();
+    Swap(other);
+
+    return *this;
+  }
+
+  FlatMap& operator=(const std::initializer_list<value_type> list) {
+    Clear();
+    InsertUnsorted(list.begin(), list.end());
+    return *this;
+  }
+
+  // Element access
+
+  const DynamicArray<Key>& Keys() const noexcept { return keys_; }
+
+  const DynamicArray<T>& Values() const noexcept { return values_; }
+
+  // Iterators
+
+  iterator begin() noexcept { return {keys_.Data(), values_.Data()}; }
+  const_iterator begin() const noexcept {
+    return {keys_.Data(), values_.Data()};
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  iterator end() noexcept { return begin() + Size(); }
+  const_iterator end() const noexcept { return begin() + Size(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  // Capacity
+
+  bool Empty() const noexcept { return keys_.Empty(); }
+
+  size_type Size() const noexcept { return keys_.Size(); }
+
+  void Reserve(const size_type new_capacity) {
+    keys_.Reserve(new_capacity);
+    values_.Reserve(new_capacity);
+  }
+
+  void ShrinkToFit() {
+    keys_.ShrinkToFit();
+    values_.ShrinkToFit();
+  }
+
+  // Modifiers
+
+  void Clear() noexcept {
+    keys_.Clear();
+    values_.Clear();
+  }
+
+  std::pair<iterator, bool> Insert(const value_type& value) {
+    const size_type index{LowerBoundIndex(value.first)};
+    if (index != Size() && !Compare{}(value.first, keys_[index])) {
+      return {begin() + index, false};
+    }
+
+    // Both arrays grow up front, and the key is taken out again if the value
+    // cannot be inserted, so the arrays always stay the same length.
+    if (Size() == keys_.Capacity() || Size() == values_.Capacity()) {
+      Reserve(std::max<size_type>(Size() * 2, 1));
+    }
+    keys_.Insert(keys_.cbegin() + index, value.first);
+    try {
+      values_.Insert(values_.cbegin() + index, value.second);
+    } catch (...) {
+      keys_.Erase(keys_.cbegin() + index);
+      throw;
+    }
+    return {begin() + index, true};
+  }
+
+  std::pair<iterator, bool> InsertOrAssign(const Key& key, const T& value) {
+    const auto [it, inserted] = Insert({key, value});
+    if (!inserted) it->second = value;
+    return {it, inserted};
+  }
+
+  // Merges a range of entries sorted by key into the map in linear time.
+  // Keys already in the map, or repeated in the range, keep the first value.
+  template <class ForwardIterator,
+            std::enable_if_t<is_iterator<ForwardIterator>, bool> = false>
+  void InsertSorted(const ForwardIterator first, const ForwardIterator last) {
+    const auto by_key = [](const auto& a, const auto& b) {
+      return Compare{}(a.first, b.first);
+    };
+    if (!std::is_sorted(first, last, by_key)) {
+      throw std::invalid_argument("range must be sorted by key");
+    }
+
+    Merge(first, last);
+  }
+
+  // Sorts a copy of the range by key and merges it in, in O(k log k + n).
+  template <class InputIterator,
+            std::enable_if_t<is_iterator<InputIterator>, bool> = false>
+  void InsertUnsorted(const InputIterator first, const InputIterator last) {
+    DynamicArray<value_type> entries;
+    for (InputIterator it{first}; it != last; ++it) {
+      entries.PushBack(*it);
+    }
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const value_type& a, const value_type& b) {
+                       return Compare{}(a.first, b.first);
+                     });
+
+    Merge(std::make_move_iterator(entries.begin()),
+          std::make_move_iterator(entries.end()));
+  }
+
+  iterator Erase(const const_iterator position) {
+    const auto index{static_cast<size_type>(position.key_ - keys_.Data())};
+    keys_.Erase(keys_.cbegin() + index);
+    values_.Erase(values_.cbegin() + index);
+    return begin() + index;
+  }
+
+  size_type Erase(const Key& key) {
+    const const_iterator it{std::as_const(*this).Find(key)};
+    if (it == cend()) return 0;
+
+    Erase(it);
+    return 1;
+  }
+
+  void Swap(FlatMap& other) noexcept {
+    keys_.Swap(other.keys_);
+    values_.Swap(other.values_);
+  }
+
+  // Lookup
+
+  T& At(const Key& key) {
+    return const_cast<T&>(std::as_const(*this).At(key));
+  }
+  const T& At(const Key& key) const {
+    const const_iterator it{Find(key)};
+    if (it == end()) throw std::out_of_range("key out of bounds");
+    return it->second;
+  }
+
+  T& operator[](const Key& key) { return Insert({key, T()}).first->second; }
+
+  size_type Count(const Key& key) const { return Contains(key) ? 1 : 0; }
+
+  iterator Find(const Key& key) {
+    const size_type index{LowerBoundIndex(key)};
+    if (index == Size() || Compare{}(key, keys_[index])) return end();
+    return begin() + index;
+  }
+  const_iterator Find(const Key& key) const {
+    return const_cast<FlatMap&>(*this).Find(key);
+  }
+
+  bool Contains(const Key& key) const { return Find(key) != end(); }
+
+  iterator LowerBound(const Key& key) {
+    return begin() + LowerBoundIndex(key);
+  }
+  const_iterator LowerBound(const Key& key) const {
+    return begin() + LowerBoundIndex(key);
+  }
+
+  iterator UpperBound(const Key& key) {
+    return begin() +
+           BranchlessUpperBound(keys_.Data(), Size(), key, Compare{});
+  }
+  const_iterator UpperBound(const Key& key) const {
+    return begin() +
+           BranchlessUpperBound(keys_.Data(), Size(), key, Compare{});
+  }
+
+  // Comparison operators
+
+  bool operator==(const FlatMap& other) const noexcept {
+    return keys_ == other.keys_ && values_ == other.values_;
+  }
+
+  bool operator!=(const FlatMap& other) const noexcept {
+    return !(*this == other);
+  }
+
+  // Debug
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const FlatMap& flat_map) noexcept {
+    os << "[";
+    for (std::size_t i{0}; i < flat_map.Size(); ++i) {
+      if (i != 0) os << ", ";
+      os << flat_map.keys_[i] << " -> " << flat_map.values_[i];
+    }
+    os << "] (" << flat_map.Size() << ")\n";
+    return os;
+  }
+
+ private:
+  size_type LowerBoundIndex(const Key& key) const {
+    return BranchlessLowerBound(keys_.Data(), Size(), key, Compare{});
+  }
+
+  // Existing entries are moved into the merged arrays only when neither keys
+  // nor values can throw while moving, and copied otherwise, so an exception
+  // leaves them intact until the final swap.
+  static constexpr bool kNothrowMove{
+      std::is_nothrow_move_constructible_v<Key> &&
+      std::is_nothrow_move_constructible_v<T>};
+
+  template <class U>
+  static std::conditional_t<kNothrowMove, U&&, const U&> MoveIfNothrow(
+      U& value) noexcept {
+    return static_cast<std::conditional_t<kNothrowMove, U&&, const U&>>(value);
+  }
+
+  // Merges the sorted range with the entries into new arrays, preferring
+  // existing entries and then earlier ones on equal keys. The new entries are
+  // gathered first, so that no copy from the range can throw once the
+  // existing entries start moving.
+  template <class ForwardIterator>
+  void Merge(const ForwardIterator first, const ForwardIterator last) {
+    const Compare compare{};
+
+    DynamicArray<Key> new_keys;
+    DynamicArray<T> new_values;
+    new_keys.Reserve(static_cast<size_type>(std::distance(first, last)));
+    new_values.Reserve(new_keys.Capacity());
+    for (ForwardIterator it{first}; it != last; ++it) {
+      if (new_keys.Empty() || compare(new_keys.Back(), (*it).first)) {
+        new_keys.PushBack((*it).first);
+        new_values.PushBack((*it).second);
+      }
+    }
+
+    DynamicArray<Key> keys;
+    DynamicArray<T> values;
+    keys.Reserve(Size() + new_keys.Size());
+    values.Reserve(keys.Capacity());
+
+    std::size_t i{0};
+    std::size_t j{0};
+    while (i != Size() || j != new_keys.Size()) {
+      if (j == new_keys.Size() ||
+          (i != Size() && !compare(new_keys[j], keys_[i]))) {
+        keys.PushBack(MoveIfNothrow(keys_[i]));
+        values.PushBack(MoveIfNothrow(values_[i]));
+        ++i;
+      } else {
+        if (keys.Empty() || compare(keys.Back(), new_keys[j])) {
+          keys.PushBack(MoveIfNothrow(new_keys[j]));
+          values.PushBack(MoveIfNothrow(new_values[j]));
+        }
+        ++j;
+      }
+    }
+
+    keys_.Swap(keys);
+    values_.Swap(values);
+  }
+
+  DynamicArray<Key> keys_;
+  DynamicArray<T> values_;
+};
+
+#endif  // CPP_ALGORITHMS_DATA_STRUCTURES_FLAT_MAP_FLAT_MAP_H_
@@ -0,0 +1,273 @@
+#include "flat_map.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "dynamic_array.h"
+
+using Map = FlatMap<int, std::string>;
+
+struct ThrowingCopy {
+  ThrowingCopy(const int value) : value{value} {}
+  ThrowingCopy(const ThrowingCopy& other) : value{other.value} {
+    if (throw_on_copy) throw std::runtime_error("copy failed");
+  }
+  ThrowingCopy(ThrowingCopy&& other) noexcept = default;
+  ThrowingCopy& operator=(const ThrowingCopy& other) = default;
+  ThrowingCopy& operator=(ThrowingCopy&& other) noexcept = default;
+
+  static inline bool throw_on_copy{false};
+  int value;
+};
+
+// Constructors
+
+TEST(FlatMapTest, Constructor) {
+  const Map flat_map;
+  EXPECT_TRUE(flat_map.Empty());
+  EXPECT_EQ(flat_map.begin(), flat_map.end());
+}
+
+TEST(FlatMapTest, CopyConstructor) {
+  const Map flat_map{{2, "b"}, {1, "a"}};
+  const Map copy{flat_map};
+  EXPECT_EQ(copy, flat_map);
+}
+
+TEST(FlatMapTest, MoveConstructor) {
+  Map flat_map{{2, "b"}, {1, "a"}};
+  const Map moved_map{std::move(flat_map)};
+  EXPECT_EQ(moved_map, (Map{{1, "a"}, {2, "b"}}));
+  EXPECT_TRUE(flat_map.Empty());
+}
+
+TEST(FlatMapTest, InitializerListConstructor) {
+  const Map flat_map{{3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+  EXPECT_EQ(flat_map.Size(), 3);
+  EXPECT_EQ(flat_map.Keys(), (DynamicArray<int>{1, 2, 3}));
+  EXPECT_EQ(flat_map.Values(), (DynamicArray<std::string>{"a", "b", "c"}));
+}
+
+// Assignments
+
+TEST(FlatMapTest, MoveAssignment) {
+  Map flat_map{{1, "a"}};
+  Map moved_map{{5, "e"}};
+
+  moved_map = std::move(flat_map);
+  EXPECT_EQ(moved_map, (Map{{1, "a"}}));
+  EXPECT_TRUE(flat_map.Empty());
+}
+
+TEST(FlatMapTest, InitializerListAssignment) {
+  Map flat_map{{1, "a"}};
+
+  flat_map = {{4, "d"}, {3, "c"}};
+  EXPECT_EQ(flat_map, (Map{{3, "c"}, {4, "d"}}));
+}
+
+// Iterators
+
+TEST(FlatMapTest, Begin) {
+  Map flat_map{{2, "b"}, {1, "a"}, {3, "c"}};
+
+  std::string values;
+  for (const auto [key, value] : flat_map) {
+    values += std::to_string(key) + value;
+  }
+  EXPECT_EQ(values, "1a2b3c");
+
+  for (auto [key, value] : flat_map) {
+    value += value;
+  }
+  flat_map.begin()->second = "z";
+  EXPECT_EQ(flat_map.At(1), "z");
+  EXPECT_EQ(flat_map.At(3), "cc");
+  EXPECT_EQ(flat_map.end() - flat_map.begin(), 3);
+  EXPECT_EQ((flat_map.end() - 1)->first, 3);
+}
+
+TEST(FlatMapTest, Begin_Const) {
+  const Map flat_map{{2, "b"}, {1, "a"}};
+  Map::const_iterator it{flat_map.cbegin()};
+  EXPECT_EQ(it->second, "a");
+  EXPECT_EQ((*++it).first, 2);
+  EXPECT_EQ(++it, flat_map.cend());
+}
+
+// Modifiers
+
+TEST(FlatMapTest, Insert) {
+  Map flat_map;
+
+  auto [it, inserted] = flat_map.Insert({2, "b"});
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(it->second, "b");
+
+  std::tie(it, inserted) = flat_map.Insert({1, "a"});
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(it, flat_map.begin());
+
+  std::tie(it, inserted) = flat_map.Insert({2, "x"});
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(it->second, "b");
+  EXPECT_EQ(flat_map, (Map{{1, "a"}, {2, "b"}}));
+}
+
+TEST(FlatMapTest, Insert_ThrowingCopy) {
+  FlatMap<int, ThrowingCopy> flat_map{{1, 1}, {2, 4}};
+
+  ThrowingCopy::throw_on_copy = true;
+  EXPECT_THROW(flat_map.Insert({0, 0}), std::runtime_error);
+  ThrowingCopy::throw_on_copy = false;
+
+  EXPECT_EQ(flat_map.Size(), 2);
+  EXPECT_EQ(flat_map.Values().Size(), 2);
+  EXPECT_FALSE(flat_map.Contains(0));
+  EXPECT_EQ(flat_map.At(1).value, 1);
+  EXPECT_EQ(flat_map.At(2).value, 4);
+}
+
+TEST(FlatMapTest, InsertOrAssign) {
+  Map flat_map{{1, "a"}};
+
+  EXPECT_FALSE(flat_map.InsertOrAssign(1, "x").second);
+  EXPECT_TRUE(flat_map.InsertOrAssign(0, "y").second);
+  EXPECT_EQ(flat_map, (Map{{0, "y"}, {1, "x"}}));
+}
+
+TEST(FlatMapTest, InsertSorted) {
+  Map flat_map{{2, "b"}, {4, "d"}, {6, "f"}};
+  const DynamicArray<std::pair<int, std::string>> entries{
+      {1, "a"}, {2, "x"}, {3, "c"}, {3, "y"}, {7, "g"}};
+
+  flat_map.InsertSorted(entries.begin(), entries.end());
+  EXPECT_EQ(flat_map, (Map{{1, "a"},
+                           {2, "b"},
+                           {3, "c"},
+                           {4, "d"},
+                           {6, "f"},
+                           {7, "g"}}));
+
+  const DynamicArray<std::pair<int, std::string>> unsorted{{2, "b"},
+                                                           {1, "a"}};
+  EXPECT_THROW(flat_map.InsertSorted(unsorted.begin(), unsorted.end()),
+               std::invalid_argument);
+}
+
+TEST(FlatMapTest, InsertSorted_ThrowingCopy) {
+  FlatMap<std::string, ThrowingCopy> flat_map{{"b", 2}, {"d", 4}};
+  const DynamicArray<std::pair<std::string, ThrowingCopy>> entries{{"c", 3}};
+
+  ThrowingCopy::throw_on_copy = true;
+  EXPECT_THROW(flat_map.InsertSorted(entries.begin(), entries.end()),
+               std::runtime_error);
+  ThrowingCopy::throw_on_copy = false;
+
+  ASSERT_EQ(flat_map.Size(), 2);
+  EXPECT_EQ(flat_map.Keys()[0], "b");
+  EXPECT_EQ(flat_map.Keys()[1], "d");
+  EXPECT_EQ(flat_map.At("b").value, 2);
+  EXPECT_EQ(flat_map.At("d").value, 4);
+}
+
+TEST(FlatMapTest, InsertUnsorted) {
+  std::mt19937 generator{42};
+  std::uniform_int_distribution<int> distribution{0, 500};
+
+  Map flat_map;
+  std::map<int, std::string> expected;
+  for (int round{0}; round < 10; ++round) {
+    DynamicArray<std::pair<int, std::string>> entries;
+    for (int i{0}; i < 100; ++i) {
+      const int key{distribution(generator)};
+      entries.PushBack({key, std::to_string(round)});
+      expected.insert({key, std::to_string(round)});
+    }
+    flat_map.InsertUnsorted(entries.begin(), entries.end());
+  }
+
+  ASSERT_EQ(flat_map.Size(), expected.size());
+  auto it{flat_map.begin()};
+  for (const auto& [key, value] : expected) {
+    EXPECT_EQ(it->first, key);
+    EXPECT_EQ(it->second, value);
+    ++it;
+  }
+}
+
+TEST(FlatMapTest, Erase) {
+  Map flat_map{{1, "a"}, {2, "b"}, {3, "c"}};
+
+  const auto next{flat_map.Erase(flat_map.Find(2))};
+  EXPECT_EQ(next->first, 3);
+  EXPECT_EQ(flat_map.Erase(1), 1);
+  EXPECT_EQ(flat_map.Erase(1), 0);
+  EXPECT_EQ(flat_map, (Map{{3, "c"}}));
+}
+
+// Lookup
+
+TEST(FlatMapTest, At) {
+  Map flat_map{{1, "a"}};
+  EXPECT_EQ(flat_map.At(1), "a");
+  EXPECT_THROW(flat_map.At(2), std::out_of_range);
+
+  flat_map.At(1) = "b";
+  EXPECT_EQ(std::as_const(flat_map).At(1), "b");
+}
+
+TEST(FlatMapTest, SubscriptOperator) {
+  Map flat_map{{1, "a"}};
+
+  flat_map[3] = "c";
+  flat_map[1] += "a";
+  EXPECT_EQ(flat_map, (Map{{1, "aa"}, {3, "c"}}));
+}
+
+TEST(FlatMapTest, Find) {
+  const Map flat_map{{1, "a"}, {3, "c"}, {5, "e"}};
+  EXPECT_EQ(flat_map.Find(3)->second, "c");
+  EXPECT_EQ(flat_map.Find(4), flat_map.end());
+  EXPECT_TRUE(flat_map.Contains(5));
+  EXPECT_EQ(flat_map.Count(0), 0);
+}
+
+TEST(FlatMapTest, LowerBound) {
+  FlatMap<int, int> flat_map;
+  for (int i{0}; i < 100; ++i) {
+    flat_map.Insert({i * 2, i});
+  }
+
+  for (int key{-1}; key < 200; ++key) {
+    const auto lower{flat_map.LowerBound(key)};
+    const auto upper{flat_map.UpperBound(key)};
+    EXPECT_EQ(lower - flat_map.begin(), (key + 1) / 2);
+    EXPECT_EQ(upper - flat_map.begin(), key / 2 + (key >= 0 ? 1 : 0));
+  }
+}
+
+TEST(FlatMapTest, Compare) {
+  FlatMap<std::string, int, std::greater<>> flat_map{{"a", 1}, {"c", 3}};
+
+  flat_map.Insert({"b", 2});
+  EXPECT_EQ(flat_map.begin()->first, "c");
+  EXPECT_EQ(flat_map.LowerBound("bb")->first, "b");
+}
+
+// Debug
+
+TEST(FlatMapTest, OutputOperator) {
+  std::ostringstream os;
+  os << Map{{2, "b"}, {1, "a"}};
+  EXPECT_EQ(os.str(), "[1 -> a, 2 -> b] (2)\n");
+}
@@ -0,0 +1,227 @@
+#ifndef CPP_ALGORITHMS_DATA_STRUCTURES_FLAT_SET_FLAT_SET_H_
+#define CPP_ALGORITHMS_DATA_STRUCTURES_FLAT_SET_FLAT_SET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "branchless_search.h"
+#include "dynamic_array.h"
+#include "is_iterator.h"
+
+// Ordered set stored as a sorted array of keys. Lookups are branchless
+// binary searches and iteration is a linear scan. Single inserts and erases
+// shift the tail and are linear; bulk inserts merge the new keys in one pass
+// instead.
+template <class Key, class Compare = std::less<Key>>
+class FlatSet {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using key_compare = Compare;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+  using pointer = const value_type*;
+  using const_pointer = const value_type*;
+  using iterator = typename DynamicArray<Key>::const_iterator;
+  using const_iterator = iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = reverse_iterator;
+
+  // Constructors
+
+  FlatSet() noexcept = default;
+
+  FlatSet(const FlatSet& other) = default;
+
+  FlatSet(FlatSet&& other) noexcept { Swap(other); }
+
+  FlatSet(const std::initializer_list<value_type> list) {
+    InsertUnsorted(list.begin(), list.end());
+  }
+
+  // Assignments
+
+  FlatSet& operator=(const FlatSet& other) = default;
+
+  FlatSet& operator=(FlatSet&& other) noexcept {
+    if (this == &other) return *this;
+
+    Clear();
+    Swap(other);
+
+    return *this;
+  }
+
+  FlatSet& operator=(const std::initializer_list<value_type> list) {
+    Clear();
+    InsertUnsorted(list.begin(), list.end());
+    return *this;
+  }
+
+  // Element access
+
+  const DynamicArray<Key>& Keys() const noexcept { return keys_; }
+
+  // Iterators
+
+  const_iterator begin() const noexcept { return keys_.begin(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  const_iterator end() const noexcept { return keys_.end(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(end());
+  }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(begin());
+  }
+
+  // Capacity
+
+  bool Empty() const noexcept { return keys_.Empty(); }
+
+  size_type Size() const noexcept { return keys_.Size(); }
+
+  void Reserve(const size_type new_capacity) { keys_.Reserve(new_capacity); }
+
+  void ShrinkToFit() { keys_.ShrinkToFit(); }
+
+  // Modifiers
+
+  void Clear() noexcept { keys_.Clear(); }
+
+  std::pair<iterator, bool> Insert(const value_type& value) {
+    const size_type index{LowerBoundIndex(value)};
+    if (index != Size() && !Compare{}(value, keys_[index])) {
+      return {begin() + index, false};
+    }
+
+    return {keys_.Insert(keys_.cbegin() + index, value), true};
+  }
+
+  // Merges a sorted range of keys into the set in linear time.
+  template <class ForwardIterator,
+            std::enable_if_t<is_iterator<ForwardIterator>, bool> = false>
+  void InsertSorted(const ForwardIterator first, const ForwardIterator last) {
+    if (!std::is_sorted(first, last, Compare{})) {
+      throw std::invalid_argument("range must be sorted");
+    }
+
+    Merge(first, last);
+  }
+
+  // Sorts a copy of the range and merges it in, in O(k log k + n).
+  template <class InputIterator,
+            std::enable_if_t<is_iterator<InputIterator>, bool> = false>
+  void InsertUnsorted(const InputIterator first, const InputIterator last) {
+    DynamicArray<value_type> keys;
+    for (InputIterator it{first}; it != last; ++it) {
+      keys.PushBack(*it);
+    }
+    std::sort(keys.begin(), keys.end(), Compare{});
+
+    Merge(std::make_move_iterator(keys.begin()),
+          std::make_move_iterator(keys.end()));
+  }
+
+  iterator Erase(const const_iterator position) {
+    return keys_.Erase(position);
+  }
+
+  size_type Erase(const Key& key) {
+    const const_iterator it{Find(key)};
+    if (it == end()) return 0;
+
+    Erase(it);
+    return 1;
+  }
+
+  void Swap(FlatSet& other) noexcept { keys_.Swap(other.keys_); }
+
+  // Lookup
+
+  size_type Count(const Key& key) const { return Contains(key) ? 1 : 0; }
+
+  const_iterator Find(const Key& key) const {
+    const size_type index{LowerBoundIndex(key)};
+    if (index == Size() || Compare{}(key, keys_[index])) return end();
+    return begin() + index;
+  }
+
+  bool Contains(const Key& key) const { return Find(key) != end(); }
+
+  const_iterator LowerBound(const Key& key) const {
+    return begin() + LowerBoundIndex(key);
+  }
+
+  const_iterator UpperBound(const Key& key) const {
+    return begin() +
+           BranchlessUpperBound(keys_.Data(), Size(), key, Compare{});
+  }
+
+  // Comparison operators
+
+  bool operator==(const FlatSet& other) const noexcept {
+    return keys_ == other.keys_;
+  }
+
+  bool operator!=(const FlatSet& other) const noexcept {
+    return !(*this == other);
+  }
+
+  // Debug
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const FlatSet& flat_set) noexcept {
+    os << "[";
+    for (std::size_t i{0}; i < flat_set.Size(); ++i) {
+      if (i != 0) os << ", ";
+      os << flat_set.keys_[i];
+    }
+    os << "] (" << flat_set.Size() << ")\n";
+    return os;
+  }
+
+ private:
+  size_type LowerBoundIndex(const Key& key) const {
+    return BranchlessLowerBound(keys_.Data(), Size(), key, Compare{});
+  }
+
+  // Merges the sorted range with the keys into a new array, dropping keys
+  // that are already present.
+  template <class ForwardIterator>
+  void Merge(const ForwardIterator first, const ForwardIterator last) {
+    const Compare compare{};
+
+    DynamicArray<Key> keys;
+    keys.Reserve(Size() + static_cast<size_type>(std::distance(first, last)));
+
+    std::size_t i{0};
+    ForwardIterator it{first};
+    while (i != Size() || it != last) {
+      if (it == last || (i != Size() && !compare(*it, keys_[i]))) {
+        keys.PushBack(std::move(keys_[i]));
+        ++i;
+      } else {
+        if (keys.Empty() || compare(keys.Back(), *it)) keys.PushBack(*it);
+        ++it;
+      }
+    }
+
+    keys_.Swap(keys);
+  }
+
+  DynamicArray<Key> keys_;
+};
+
+#endif  // CPP_ALGORITHMS_DATA_STRUCTURES_FLAT_SET_FLAT_SET_H_
@@ -0,0 +1,153 @@
+#include "flat_set.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "dynamic_array.h"
+
+// Constructors
+
+TEST(FlatSetTest, Constructor) {
+  const FlatSet<int> flat_set;
+  EXPECT_TRUE(flat_set.Empty());
+  EXPECT_EQ(flat_set.begin(), flat_set.end());
+}
+
+TEST(FlatSetTest, MoveConstructor) {
+  FlatSet<std::string> flat_set{"b", "a"};
+  const FlatSet<std::string> moved_set{std::move(flat_set)};
+  EXPECT_EQ(moved_set, (FlatSet<std::string>{"a", "b"}));
+  EXPECT_TRUE(flat_set.Empty());
+}
+
+TEST(FlatSetTest, InitializerListConstructor) {
+  const FlatSet<int> flat_set{5, 1, 3, 1, 5};
+  EXPECT_EQ(flat_set.Keys(), (DynamicArray<int>{1, 3, 5}));
+}
+
+// Assignments
+
+TEST(FlatSetTest, InitializerListAssignment) {
+  FlatSet<int> flat_set{1};
+
+  flat_set = {3, 2};
+  EXPECT_EQ(flat_set, (FlatSet<int>{2, 3}));
+}
+
+// Iterators
+
+TEST(FlatSetTest, Begin) {
+  const FlatSet<int> flat_set{3, 1, 2};
+
+  int previous{0};
+  for (const int key : flat_set) {
+    EXPECT_EQ(key, previous + 1);
+    previous = key;
+  }
+  EXPECT_EQ(*flat_set.rbegin(), 3);
+}
+
+// Modifiers
+
+TEST(FlatSetTest, Insert) {
+  FlatSet<int> flat_set{1, 5};
+
+  auto [it, inserted] = flat_set.Insert(3);
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(it - flat_set.begin(), 1);
+
+  std::tie(it, inserted) = flat_set.Insert(5);
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(flat_set, (FlatSet<int>{1, 3, 5}));
+}
+
+TEST(FlatSetTest, InsertSorted) {
+  FlatSet<int> flat_set{2, 4};
+  const DynamicArray<int> keys{1, 2, 3, 3, 5};
+
+  flat_set.InsertSorted(keys.begin(), keys.end());
+  EXPECT_EQ(flat_set.Keys(), (DynamicArray<int>{1, 2, 3, 4, 5}));
+
+  const DynamicArray<int> unsorted{2, 1};
+  EXPECT_THROW(flat_set.InsertSorted(unsorted.begin(), unsorted.end()),
+               std::invalid_argument);
+}
+
+TEST(FlatSetTest, InsertUnsorted) {
+  std::mt19937 generator{7};
+  std::uniform_int_distribution<int> distribution{-1000, 1000};
+
+  FlatSet<int> flat_set;
+  std::set<int> expected;
+  for (int round{0}; round < 10; ++round) {
+    DynamicArray<int> keys;
+    for (int i{0}; i < 200; ++i) {
+      keys.PushBack(distribution(generator));
+      expected.insert(keys.Back());
+    }
+    flat_set.InsertUnsorted(keys.begin(), keys.end());
+  }
+
+  ASSERT_EQ(flat_set.Size(), expected.size());
+  EXPECT_TRUE(std::equal(flat_set.begin(), flat_set.end(), expected.begin()));
+}
+
+TEST(FlatSetTest, Erase) {
+  FlatSet<int> flat_set{1, 2, 3};
+
+  EXPECT_EQ(*flat_set.Erase(flat_set.Find(2)), 3);
+  EXPECT_EQ(flat_set.Erase(3), 1);
+  EXPECT_EQ(flat_set.Erase(3), 0);
+  EXPECT_EQ(flat_set, (FlatSet<int>{1}));
+}
+
+// Lookup
+
+TEST(FlatSetTest, Find) {
+  const FlatSet<std::string> flat_set{"b", "d", "a"};
+  EXPECT_EQ(*flat_set.Find("b"), "b");
+  EXPECT_EQ(flat_set.Find("c"), flat_set.end());
+  EXPECT_TRUE(flat_set.Contains("d"));
+  EXPECT_EQ(flat_set.Count("e"), 0);
+}
+
+TEST(FlatSetTest, LowerBound) {
+  FlatSet<int> flat_set;
+  for (int i{0}; i < 77; ++i) {
+    flat_set.Insert(i * 3);
+  }
+
+  const std::set<int> expected(flat_set.begin(), flat_set.end());
+  for (int key{-2}; key < 233; ++key) {
+    EXPECT_EQ(flat_set.LowerBound(key) - flat_set.begin(),
+              std::distance(expected.begin(), expected.lower_bound(key)));
+    EXPECT_EQ(flat_set.UpperBound(key) - flat_set.begin(),
+              std::distance(expected.begin(), expected.upper_bound(key)));
+  }
+}
+
+TEST(FlatSetTest, Compare) {
+  const FlatSet<int, std::greater<>> flat_set{1, 3, 2};
+  EXPECT_EQ(flat_set.Keys(), (DynamicArray<int>{3, 2, 1}));
+  EXPECT_EQ(*flat_set.LowerBound(2), 2);
+  EXPECT_EQ(*flat_set.UpperBound(2), 1);
+}
+
+// Debug
+
+TEST(FlatSetTest, OutputOperator) {
+  std::ostringstream os;
+  os << FlatSet<int>{2, 1};
+  EXPECT_EQ(os.str(), "[1, 2] (2)\n");
+}
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
@@ -12,6 +13,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "binary_serialization.h"
 #include "doubly_linked_list.h"
 #include "dynamic_array.h"
 
@@ -326,6 +328,44 @@ class HashMap {
     return !(*this == other);
   }
 
+  // Serialization
+
+  void Serialize(const int fd) const {
+    BinaryWriter writer{fd};
+    Serialize(writer);
+    writer.Flush();
+  }
+
+  void Serialize(BinaryWriter& writer) const {
+    writer.Write(static_cast<std::uint64_t>(Size()));
+    writer.Write(max_load_factor_);
+
+    for (const value_type& value : *this) {
+      writer.Write(value);
+    }
+  }
+
+  void Deserialize(const int fd) {
+    BinaryReader reader{fd};
+    Deserialize(reader);
+  }
+
+  void Deserialize(BinaryReader& reader) {
+    Clear();
+    const std::size_t size{
+        static_cast<std::size_t>(reader.Read<std::uint64_t>())};
+    const float max_load_factor{reader.Read<float>()};
+    if (!(max_load_factor > 0.0f) || std::isinf(max_load_factor)) {
+      throw std::runtime_error("invalid max load factor");
+    }
+    max_load_factor_ = max_load_factor;
+    Reserve(size);
+
+    for (std::size_t i{0}; i < size; ++i) {
+      InsertUnchecked(reader.Read<value_type>());
+    }
+  }
+
   // Debug
 
   friend std::ostream& operator<<(std::ostream& os,
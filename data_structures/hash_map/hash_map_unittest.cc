@@ -1,8 +1,13 @@
 #include "hash_map.h"
 
 #include <gtest/gtest.h>
+#include <unistd.h>
 
+#include <cstdint>
+#include <cstdio>
+#include <limits>
 #include <stdexcept>
+#include <string>
 #include <utility>
 
 using Pair = std::pair<const int, int>;
@@ -575,4 +580,74 @@ TEST(HashMapTest, NotEqualOperator) {
   const HashMap<int, int> a{{1, 1}, {2, 4}, {3, 9}};
   const HashMap<int, int> b{{4, 16}, {5, 25}, {6, 36}};
   EXPECT_NE(a, b);
-}
\ No newline at end of file
+}
+
+// Serialization
+
+TEST(HashMapTest, Serialize) {
+  HashMap<int, int> hash_map;
+  for (int i{0}; i < 1000; ++i) {
+    hash_map.Insert({i, i * i});
+  }
+  std::FILE* const file{std::tmpfile()};
+
+  hash_map.Serialize(fileno(file));
+  EXPECT_EQ(lseek(fileno(file), 0, SEEK_END),
+            sizeof(std::uint64_t) + sizeof(float) + 1000 * 2 * sizeof(int));
+  std::fclose(file);
+}
+
+TEST(HashMapTest, Deserialize) {
+  const HashMap<int, int> hash_map{{1, 1}, {2, 4}, {3, 9}};
+  std::FILE* const file{std::tmpfile()};
+  hash_map.Serialize(fileno(file));
+  lseek(fileno(file), 0, SEEK_SET);
+
+  HashMap<int, int> deserialized{{4, 16}};
+  deserialized.Deserialize(fileno(file));
+  EXPECT_EQ(deserialized, hash_map);
+  EXPECT_EQ(deserialized.BucketCount(), hash_map.Size());
+  std::fclose(file);
+}
+
+TEST(HashMapTest, Deserialize_LengthPrefixed) {
+  const HashMap<std::string, std::string> hash_map{
+      {"a", ""}, {"bb", std::string(100, 'b')}, {"", "c"}};
+  std::FILE* const file{std::tmpfile()};
+  hash_map.Serialize(fileno(file));
+  lseek(fileno(file), 0, SEEK_SET);
+
+  HashMap<std::string, std::string> deserialized;
+  deserialized.Deserialize(fileno(file));
+  EXPECT_EQ(deserialized, hash_map);
+  std::fclose(file);
+}
+
+TEST(HashMapTest, Deserialize_Truncated) {
+  const HashMap<int, int> hash_map{{1, 1}, {2, 4}, {3, 9}};
+  std::FILE* const file{std::tmpfile()};
+  hash_map.Serialize(fileno(file));
+  ftruncate(fileno(file), lseek(fileno(file), 0, SEEK_END) - 1);
+  lseek(fileno(file), 0, SEEK_SET);
+
+  HashMap<int, int> deserialized;
+  EXPECT_THROW(deserialized.Deserialize(fileno(file)), std::runtime_error);
+  std::fclose(file);
+}
+
+TEST(HashMapTest, Deserialize_InvalidMaxLoadFactor) {
+  const HashMap<int, int> hash_map{{1, 1}, {2, 4}, {3, 9}};
+  for (const float max_load_factor :
+       {0.0f, -1.0f, std::numeric_limits<float>::quiet_NaN(),
+        std::numeric_limits<float>::infinity()}) {
+    std::FILE* const file{std::tmpfile()};
+    hash_map.Serialize(fileno(file));
+    pwrite(fileno(file), &max_load_factor, sizeof(float),
+           sizeof(std::uint64_t));
+    lseek(fileno(file), 0, SEEK_SET);
+
+    HashMap<int, int> deserialized;
+    EXPECT_THROW(deserialized.Deserialize(fileno(file)), std::runtime_error);
+    std::fclose(file);
+  }
+}
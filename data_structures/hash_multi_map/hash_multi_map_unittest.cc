@@ -0,0 +1,227 @@
+#include "hash_multi_map.h"
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <utility>
+
+using Pair = std::pair<const int, int>;
+
+bool IsContiguous(const HashMultiMap<int, int>& hash_map, const int key) {
+  const auto [first, last] = hash_map.EqualRange(key);
+  std::size_t run{0};
+  for (auto it{first}; it != last; ++it) {
+    if (it->first != key) return false;
+    ++run;
+  }
+  return run == hash_map.Count(key);
+}
+
+// Constructors
+
+TEST(HashMultiMapTest, Constructor) {
+  const HashMultiMap<int, int> hash_map;
+  EXPECT_EQ(hash_map.Size(), 0);
+  EXPECT_EQ(hash_map.BucketCount(), 0);
+}
+
+TEST(HashMultiMapTest, CopyConstructor) {
+  const HashMultiMap<int, int> hash_map{{1, 1}, {2, 4}, {1, 2}};
+
+  const HashMultiMap<int, int> copy{hash_map};
+  EXPECT_EQ(copy, hash_map);
+  EXPECT_TRUE(IsContiguous(copy, 1));
+}
+
+TEST(HashMultiMapTest, MoveConstructor) {
+  HashMultiMap<int, int> hash_map{{1, 1}, {2, 4}, {1, 2}};
+
+  const HashMultiMap<int, int> moved_hash_map{std::move(hash_map)};
+  EXPECT_EQ(moved_hash_map.Size(), 3);
+  EXPECT_EQ(hash_map.Size(), 0);
+}
+
+TEST(HashMultiMapTest, InitializerListConstructor) {
+  const HashMultiMap<int, int> hash_map{{1, 1}, {2, 4}, {1, 2}, {1, 3}};
+  EXPECT_EQ(hash_map.Size(), 4);
+  EXPECT_EQ(hash_map.Count(1), 3);
+  EXPECT_EQ(hash_map.Count(2), 1);
+}
+
+// Assignments
+
+TEST(HashMultiMapTest, CopyAssignment) {
+  const HashMultiMap<int, int> hash_map{{1, 1}, {2, 4}, {1, 2}};
+  HashMultiMap<int, int> copy{{3, 9}};
+
+  copy = hash_map;
+  EXPECT_EQ(copy, hash_map);
+}
+
+TEST(HashMultiMapTest, MoveAssignment) {
+  HashMultiMap<int, int> hash_map{{1, 1}, {2, 4}, {1, 2}};
+  HashMultiMap<int, int> moved_hash_map;
+
+  moved_hash_map = std::move(hash_map);
+  EXPECT_EQ(moved_hash_map.Size(), 3);
+  EXPECT_EQ(hash_map.Size(), 0);
+}
+
+// Modifiers
+
+TEST(HashMultiMapTest, Clear) {
+  HashMultiMap<int, int> hash_map{{1, 1}, {2, 4}, {1, 2}};
+
+  hash_map.Clear();
+  EXPECT_TRUE(hash_map.Empty());
+  EXPECT_EQ(hash_map.Count(1), 0);
+
+  hash_map.Insert({1, 3});
+  EXPECT_EQ(hash_map.Count(1), 1);
+}
+
+TEST(HashMultiMapTest, Insert) {
+  HashMultiMap<int, int> hash_map;
+
+  EXPECT_EQ(*hash_map.Insert({1, 1}), (Pair{1, 1}));
+  EXPECT_EQ(*hash_map.Insert({1, 2}), (Pair{1, 2}));
+  EXPECT_EQ(hash_map.Size(), 2);
+  EXPECT_EQ(hash_map.Count(1), 2);
+}
+
+TEST(HashMultiMapTest, Insert_Grouped) {
+  HashMultiMap<int, int> hash_map;
+  hash_map.MaxLoadFactor(4);
+
+  for (int i{0}; i < 1000; ++i) {
+    hash_map.Insert({i % 37, i});
+  }
+  EXPECT_EQ(hash_map.Size(), 1000);
+
+  for (int key{0}; key < 37; ++key) {
+    EXPECT_TRUE(IsContiguous(hash_map, key));
+
+    const auto [first, last] = hash_map.EqualRange(key);
+    int expected{key};
+    for (auto it{first}; it != last; ++it) {
+      EXPECT_EQ(it->second, expected);
+      expected += 37;
+    }
+  }
+}
+
+TEST(HashMultiMapTest, Erase_Iterator) {
+  HashMultiMap<int, int> hash_map{{1, 1}, {1, 2}, {2, 4}};
+
+  hash_map.Erase(hash_map.Find(1));
+  EXPECT_EQ(hash_map.Size(), 2);
+  EXPECT_EQ(hash_map.Count(1), 1);
+  EXPECT_EQ(hash_map.Find(1)->second, 2);
+}
+
+TEST(HashMultiMapTest, Erase_Range) {
+  HashMultiMap<int, int> hash_map{{1, 1}, {1, 2}, {2, 4}, {1, 3}};
+
+  const auto [first, last] = hash_map.EqualRange(1);
+  hash_map.Erase(first, last);
+  EXPECT_EQ(hash_map, (HashMultiMap<int, int>{{2, 4}}));
+}
+
+TEST(HashMultiMapTest, Erase_Key) {
+  HashMultiMap<int, int> hash_map{{1, 1}, {1, 2}, {2, 4}, {1, 3}};
+
+  EXPECT_EQ(hash_map.Erase(1), 3);
+  EXPECT_EQ(hash_map.Erase(1), 0);
+  EXPECT_EQ(hash_map.Erase(2), 1);
+  EXPECT_TRUE(hash_map.Empty());
+}
+
+TEST(HashMultiMapTest, Swap) {
+  HashMultiMap<int, int> a{{1, 1}, {1, 2}};
+  HashMultiMap<int, int> b{{2, 4}};
+  const HashMultiMap<int, int> expected_a{b};
+  const HashMultiMap<int, int> expected_b{a};
+
+  a.Swap(b);
+  EXPECT_EQ(a, expected_a);
+  EXPECT_EQ(b, expected_b);
+}
+
+// Lookup
+
+TEST(HashMultiMapTest, Count) {
+  const HashMultiMap<int, int> hash_map{{1, 1}, {1, 2}, {2, 4}};
+  EXPECT_EQ(hash_map.Count(1), 2);
+  EXPECT_EQ(hash_map.Count(2), 1);
+  EXPECT_EQ(hash_map.Count(3), 0);
+}
+
+TEST(HashMultiMapTest, Find) {
+  HashMultiMap<int, int> hash_map{{1, 1}, {1, 2}};
+  EXPECT_EQ(*hash_map.Find(1), (Pair{1, 1}));
+  EXPECT_EQ(hash_map.Find(2), hash_map.end());
+
+  hash_map.Find(1)->second = 3;
+  EXPECT_EQ(hash_map.Find(1)->second, 3);
+}
+
+TEST(HashMultiMapTest, Contains) {
+  const HashMultiMap<int, int> hash_map{{1, 1}};
+  EXPECT_TRUE(hash_map.Contains(1));
+  EXPECT_FALSE(hash_map.Contains(2));
+}
+
+TEST(HashMultiMapTest, EqualRange) {
+  HashMultiMap<int, int> hash_map{{1, 1}, {2, 4}, {1, 2}, {3, 9}, {1, 3}};
+
+  const auto [first, last] = hash_map.EqualRange(1);
+  EXPECT_EQ(std::distance(first, last), 3);
+  EXPECT_EQ(first->second, 1);
+  EXPECT_EQ(std::next(first, 2)->second, 3);
+
+  const auto [missing_first, missing_last] = hash_map.EqualRange(4);
+  EXPECT_EQ(missing_first, hash_map.end());
+  EXPECT_EQ(missing_last, hash_map.end());
+}
+
+// Bucket interface
+
+TEST(HashMultiMapTest, BucketSize) {
+  const HashMultiMap<int, int> hash_map{{1, 1}, {1, 2}};
+  const std::size_t bucket{hash_map.Bucket(1)};
+  EXPECT_EQ(hash_map.BucketSize(bucket), 2);
+  EXPECT_EQ(std::distance(hash_map.begin(bucket), hash_map.end(bucket)), 2);
+}
+
+// Hash policy
+
+TEST(HashMultiMapTest, Rehash) {
+  HashMultiMap<int, int> hash_map{{1, 1}, {2, 4}, {1, 2}};
+
+  hash_map.Rehash(16);
+  EXPECT_EQ(hash_map.BucketCount(), 16);
+  EXPECT_EQ(hash_map.Count(1), 2);
+  EXPECT_TRUE(IsContiguous(hash_map, 1));
+  EXPECT_EQ(hash_map.Find(1)->second, 1);
+}
+
+TEST(HashMultiMapTest, Reserve) {
+  HashMultiMap<int, int> hash_map;
+
+  hash_map.Reserve(10);
+  EXPECT_EQ(hash_map.BucketCount(), 10);
+}
+
+// Comparison operators
+
+TEST(HashMultiMapTest, EqualOperator) {
+  const HashMultiMap<int, int> a{{1, 1}, {1, 2}, {2, 4}};
+  const HashMultiMap<int, int> b{{2, 4}, {1, 2}, {1, 1}};
+  EXPECT_EQ(a, b);
+}
+
+TEST(HashMultiMapTest, NotEqualOperator) {
+  const HashMultiMap<int, int> a{{1, 1}, {1, 2}, {2, 4}};
+  const HashMultiMap<int, int> b{{1, 1}, {2, 4}, {2, 4}};
+  EXPECT_NE(a, b);
+}
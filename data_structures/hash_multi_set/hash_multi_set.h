@@ -0,0 +1,358 @@
+#ifndef CPP_ALGORITHMS_DATA_STRUCTURES_HASH_MULTI_SET_HASH_MULTI_SET_H_
+#define CPP_ALGORITHMS_DATA_STRUCTURES_HASH_MULTI_SET_HASH_MULTI_SET_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+#include "doubly_linked_list.h"
+#include "dynamic_array.h"
+#include "is_iterator.h"
+
+// Uses the same bucket layout as HashMultiMap: equal keys form one run.
+template <class Key, class Hash = std::hash<Key>>
+class HashMultiSet {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = typename DoublyLinkedList<const value_type>::iterator;
+  using const_iterator =
+      typename DoublyLinkedList<const value_type>::const_iterator;
+  using local_iterator = iterator;
+  using const_local_iterator = const_iterator;
+
+  // Constructors
+
+  HashMultiSet() noexcept = default;
+
+  HashMultiSet(const HashMultiSet& other) {
+    max_load_factor_ = other.max_load_factor_;
+    Reserve(other.Size());
+
+    for (const value_type& value : other) {
+      InsertUnchecked(value);
+    }
+  }
+
+  HashMultiSet(HashMultiSet&& other) noexcept {
+    Swap(other);
+    other.max_load_factor_ = 1;
+  }
+
+  HashMultiSet(const std::initializer_list<value_type> list) { Insert(list); }
+
+  // Assignments
+
+  HashMultiSet& operator=(const HashMultiSet& other) {
+    if (this == &other) return *this;
+
+    Clear();
+    CheckRehash(other.Size());
+
+    for (const value_type& value : other) {
+      InsertUnchecked(value);
+    }
+
+    return *this;
+  }
+
+  HashMultiSet& operator=(HashMultiSet&& other) noexcept {
+    if (this == &other) return *this;
+
+    Clear();
+    Swap(other);
+    other.max_load_factor_ = 1;
+
+    return *this;
+  }
+
+  HashMultiSet& operator=(const std::initializer_list<value_type> list) {
+    Clear();
+    Insert(list);
+    return *this;
+  }
+
+  // Iterators
+
+  iterator begin() noexcept { return elements_.begin(); }
+  const_iterator begin() const noexcept { return elements_.begin(); }
+  const_iterator cbegin() const noexcept { return elements_.cbegin(); }
+
+  iterator end() noexcept { return elements_.end(); }
+  const_iterator end() const noexcept { return elements_.end(); }
+  const_iterator cend() const noexcept { return elements_.cend(); }
+
+  // Capacity
+
+  bool Empty() const noexcept { return elements_.Empty(); }
+
+  size_type Size() const noexcept { return elements_.Size(); }
+
+  // Modifiers
+
+  void Clear() noexcept {
+    elements_.Clear();
+    for (auto& bucket : buckets_) {
+      bucket = {end(), 0};
+    }
+  }
+
+  iterator Insert(const value_type& value) {
+    CheckRehash(1);
+    return InsertUnchecked(value);
+  }
+
+  template <class InputIterator,
+            std::enable_if_t<is_iterator<InputIterator>, bool> = false>
+  void Insert(const InputIterator first, const InputIterator last) {
+    if (first == last) return;
+
+    const std::size_t distance{
+        static_cast<std::size_t>(std::distance(first, last))};
+    CheckRehash(distance);
+
+    for (InputIterator it{first}; it != last; ++it) {
+      InsertUnchecked(*it);
+    }
+  }
+
+  void Insert(const std::initializer_list<value_type> list) {
+    Insert(list.begin(), list.end());
+  }
+
+  iterator Erase(const const_iterator position) {
+    auto& bucket{buckets_[Bucket(*position)]};
+    if (const_iterator(bucket.first) == position) {
+      bucket.first = std::next(bucket.first);
+    }
+    if (--bucket.second == 0) bucket.first = end();
+
+    return elements_.Erase(position);
+  }
+
+  iterator Erase(const_iterator first, const const_iterator last) {
+    while (first != last) {
+      first = Erase(first);
+    }
+    return MutableIterator(last);
+  }
+
+  size_type Erase(const Key& key) {
+    const auto [first, last] = EqualRange(key);
+    const std::size_t count{
+        static_cast<std::size_t>(std::distance(first, last))};
+
+    Erase(first, last);
+    return count;
+  }
+
+  void Swap(HashMultiSet& other) noexcept {
+    std::swap(elements_, other.elements_);
+    std::swap(buckets_, other.buckets_);
+  }
+
+  // Lookup
+
+  size_type Count(const Key& key) const {
+    const auto [first, last] = EqualRange(key);
+    return std::distance(first, last);
+  }
+
+  iterator Find(const Key& key) {
+    return MutableIterator(std::as_const(*this).Find(key));
+  }
+  const_iterator Find(const Key& key) const {
+    if (Empty()) return end();
+
+    const auto& bucket{buckets_[Bucket(key)]};
+    const_iterator it{bucket.first};
+    for (std::size_t i{0}; i < bucket.second; ++i, ++it) {
+      if (*it == key) return it;
+    }
+    return end();
+  }
+
+  bool Contains(const Key& key) const { return Find(key) != end(); }
+
+  std::pair<iterator, iterator> EqualRange(const Key& key) {
+    const auto [first, last] = std::as_const(*this).EqualRange(key);
+    return {MutableIterator(first), MutableIterator(last)};
+  }
+  std::pair<const_iterator, const_iterator> EqualRange(const Key& key) const {
+    if (Empty()) return {end(), end()};
+
+    const auto& bucket{buckets_[Bucket(key)]};
+    const_iterator it{bucket.first};
+    std::size_t i{0};
+    while (i < bucket.second && !(*it == key)) {
+      ++it;
+      ++i;
+    }
+
+    const const_iterator first{it};
+    while (i < bucket.second && *it == key) {
+      ++it;
+      ++i;
+    }
+    if (first == it) return {end(), end()};
+    return {first, it};
+  }
+
+  // Bucket interface
+
+  local_iterator begin(const size_type n) noexcept { return buckets_[n].first; }
+  const_local_iterator begin(const size_type n) const noexcept {
+    return buckets_[n].first;
+  }
+  const_local_iterator cbegin(const size_type n) const noexcept {
+    return begin(n);
+  }
+
+  local_iterator end(const size_type n) noexcept {
+    return std::next(buckets_[n].first, buckets_[n].second);
+  }
+  const_local_iterator end(const size_type n) const noexcept {
+    return std::next(const_iterator(buckets_[n].first), buckets_[n].second);
+  }
+  const_local_iterator cend(const size_type n) const noexcept { return end(n); }
+
+  size_type BucketCount() const { return buckets_.Size(); }
+
+  size_type BucketSize(const size_type n) const { return buckets_[n].second; }
+
+  size_type Bucket(const Key& key) const { return Hash{}(key) % BucketCount(); }
+
+  // Hash policy
+
+  float LoadFactor() const {
+    return Empty() ? 0 : static_cast<float>(Size()) / BucketCount();
+  }
+
+  float MaxLoadFactor() const { return max_load_factor_; }
+  void MaxLoadFactor(const float max_load_factor) {
+    max_load_factor_ = max_load_factor;
+  }
+
+  void Rehash(const size_type count) {
+    const std::size_t min_count{
+        static_cast<std::size_t>(std::ceil(Size() / max_load_factor_))};
+    const std::size_t new_size{std::max(min_count, count)};
+
+    DoublyLinkedList<const value_type> new_elements;
+    DynamicArray<std::pair<iterator, std::size_t>> new_buckets;
+    new_buckets.Resize(new_size, {new_elements.end(), 0});
+
+    DoublyLinkedList<const value_type> old_elements{std::move(elements_)};
+    elements_ = std::move(new_elements);
+    buckets_ = std::move(new_buckets);
+
+    for (const value_type& value : old_elements) {
+      InsertUnchecked(value);
+    }
+  }
+
+  void Reserve(const size_type count) {
+    Rehash(std::ceil(count / max_load_factor_));
+  }
+
+  // Comparison operators
+
+  bool operator==(const HashMultiSet& other) const noexcept {
+    if (Size() != other.Size()) return false;
+
+    for (auto it{begin()}; it != end();) {
+      const auto [first, last] = EqualRange(*it);
+      const auto [other_first, other_last] = other.EqualRange(*it);
+      if (!std::is_permutation(first, last, other_first, other_last))
+        return false;
+      it = last;
+    }
+    return true;
+  }
+
+  bool operator!=(const HashMultiSet& other) const noexcept {
+    return !(*this == other);
+  }
+
+  // Debug
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const HashMultiSet& hash_set) noexcept {
+    os << "[";
+
+    if (!hash_set.Empty()) {
+      for (auto it{hash_set.begin()}; it != std::prev(hash_set.end()); ++it) {
+        const auto& key{*it};
+        const std::size_t bucket{hash_set.Bucket(key)};
+        os << key << " (" << bucket << "), ";
+      }
+
+      const auto& key{*std::prev(hash_set.end())};
+      const std::size_t bucket{hash_set.Bucket(key)};
+      os << key << " (" << bucket << ")";
+    }
+
+    os << "] (" << hash_set.Size() << ", buckets: " << hash_set.BucketCount()
+       << ")\n";
+    return os;
+  }
+
+ private:
+  iterator MutableIterator(const const_iterator it) {
+    return elements_.Erase(it, it);
+  }
+
+  iterator InsertUnchecked(const value_type& value) {
+    auto& bucket{buckets_[Bucket(value)]};
+    if (bucket.second == 0) {
+      bucket.first = elements_.Insert(end(), value);
+      bucket.second = 1;
+      return bucket.first;
+    }
+
+    iterator position{bucket.first};
+    std::size_t i{0};
+    while (i < bucket.second && !(*position == value)) {
+      ++position;
+      ++i;
+    }
+
+    if (i == bucket.second) {
+      bucket.first = elements_.Insert(bucket.first, value);
+      ++bucket.second;
+      return bucket.first;
+    }
+
+    while (i < bucket.second && *position == value) {
+      ++position;
+      ++i;
+    }
+    ++bucket.second;
+    return elements_.Insert(position, value);
+  }
+
+  void CheckRehash(const std::size_t additional) {
+    const std::size_t new_size{Size() + additional};
+    if (new_size > max_load_factor_ * BucketCount())
+      Rehash(std::max(new_size, Size() * 2));
+  }
+
+  DoublyLinkedList<const value_type> elements_;
+  DynamicArray<std::pair<iterator, std::size_t>> buckets_;
+  float max_load_factor_{1.0};
+};
+
+#endif  // CPP_ALGORITHMS_DATA_STRUCTURES_HASH_MULTI_SET_HASH_MULTI_SET_H_
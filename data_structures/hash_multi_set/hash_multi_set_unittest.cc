@@ -0,0 +1,168 @@
+#include "hash_multi_set.h"
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <utility>
+
+// Constructors
+
+TEST(HashMultiSetTest, Constructor) {
+  const HashMultiSet<int> hash_set;
+  EXPECT_EQ(hash_set.Size(), 0);
+  EXPECT_EQ(hash_set.BucketCount(), 0);
+}
+
+TEST(HashMultiSetTest, CopyConstructor) {
+  const HashMultiSet<int> hash_set{1, 2, 1};
+
+  const HashMultiSet<int> copy{hash_set};
+  EXPECT_EQ(copy, hash_set);
+}
+
+TEST(HashMultiSetTest, MoveConstructor) {
+  HashMultiSet<int> hash_set{1, 2, 1};
+
+  const HashMultiSet<int> moved_hash_set{std::move(hash_set)};
+  EXPECT_EQ(moved_hash_set.Size(), 3);
+  EXPECT_EQ(hash_set.Size(), 0);
+}
+
+TEST(HashMultiSetTest, InitializerListConstructor) {
+  const HashMultiSet<int> hash_set{1, 2, 1, 1};
+  EXPECT_EQ(hash_set.Size(), 4);
+  EXPECT_EQ(hash_set.Count(1), 3);
+  EXPECT_EQ(hash_set.Count(2), 1);
+}
+
+// Assignments
+
+TEST(HashMultiSetTest, CopyAssignment) {
+  const HashMultiSet<int> hash_set{1, 2, 1};
+  HashMultiSet<int> copy{3};
+
+  copy = hash_set;
+  EXPECT_EQ(copy, hash_set);
+}
+
+TEST(HashMultiSetTest, MoveAssignment) {
+  HashMultiSet<int> hash_set{1, 2, 1};
+  HashMultiSet<int> moved_hash_set;
+
+  moved_hash_set = std::move(hash_set);
+  EXPECT_EQ(moved_hash_set.Size(), 3);
+  EXPECT_EQ(hash_set.Size(), 0);
+}
+
+// Modifiers
+
+TEST(HashMultiSetTest, Clear) {
+  HashMultiSet<int> hash_set{1, 2, 1};
+
+  hash_set.Clear();
+  EXPECT_TRUE(hash_set.Empty());
+  EXPECT_EQ(hash_set.Count(1), 0);
+}
+
+TEST(HashMultiSetTest, Insert) {
+  HashMultiSet<int> hash_set;
+
+  EXPECT_EQ(*hash_set.Insert(1), 1);
+  EXPECT_EQ(*hash_set.Insert(1), 1);
+  EXPECT_EQ(hash_set.Size(), 2);
+  EXPECT_EQ(hash_set.Count(1), 2);
+}
+
+TEST(HashMultiSetTest, Insert_Grouped) {
+  HashMultiSet<int> hash_set;
+  hash_set.MaxLoadFactor(4);
+
+  for (int i{0}; i < 1000; ++i) {
+    hash_set.Insert(i % 37);
+  }
+
+  for (int key{0}; key < 37; ++key) {
+    const auto [first, last] = hash_set.EqualRange(key);
+    EXPECT_EQ(static_cast<std::size_t>(std::distance(first, last)),
+              hash_set.Count(key));
+    for (auto it{first}; it != last; ++it) {
+      EXPECT_EQ(*it, key);
+    }
+  }
+}
+
+TEST(HashMultiSetTest, Erase_Iterator) {
+  HashMultiSet<int> hash_set{1, 1, 2};
+
+  hash_set.Erase(hash_set.Find(1));
+  EXPECT_EQ(hash_set.Size(), 2);
+  EXPECT_EQ(hash_set.Count(1), 1);
+}
+
+TEST(HashMultiSetTest, Erase_Key) {
+  HashMultiSet<int> hash_set{1, 1, 2, 1};
+
+  EXPECT_EQ(hash_set.Erase(1), 3);
+  EXPECT_EQ(hash_set.Erase(1), 0);
+  EXPECT_EQ(hash_set, (HashMultiSet<int>{2}));
+}
+
+TEST(HashMultiSetTest, Swap) {
+  HashMultiSet<int> a{1, 1};
+  HashMultiSet<int> b{2};
+  const HashMultiSet<int> expected_a{b};
+  const HashMultiSet<int> expected_b{a};
+
+  a.Swap(b);
+  EXPECT_EQ(a, expected_a);
+  EXPECT_EQ(b, expected_b);
+}
+
+// Lookup
+
+TEST(HashMultiSetTest, Count) {
+  const HashMultiSet<int> hash_set{1, 1, 2};
+  EXPECT_EQ(hash_set.Count(1), 2);
+  EXPECT_EQ(hash_set.Count(3), 0);
+}
+
+TEST(HashMultiSetTest, Find) {
+  const HashMultiSet<int> hash_set{1, 1};
+  EXPECT_EQ(*hash_set.Find(1), 1);
+  EXPECT_EQ(hash_set.Find(2), hash_set.end());
+}
+
+TEST(HashMultiSetTest, EqualRange) {
+  const HashMultiSet<int> hash_set{1, 2, 1, 3, 1};
+
+  const auto [first, last] = hash_set.EqualRange(1);
+  EXPECT_EQ(std::distance(first, last), 3);
+
+  const auto [missing_first, missing_last] = hash_set.EqualRange(4);
+  EXPECT_EQ(missing_first, hash_set.end());
+  EXPECT_EQ(missing_last, hash_set.end());
+}
+
+// Hash policy
+
+TEST(HashMultiSetTest, Rehash) {
+  HashMultiSet<int> hash_set{1, 2, 1};
+
+  hash_set.Rehash(16);
+  EXPECT_EQ(hash_set.BucketCount(), 16);
+  EXPECT_EQ(hash_set.Count(1), 2);
+}
+
+// Comparison operators
+
+TEST(HashMultiSetTest, EqualOperator) {
+  const HashMultiSet<int> a{1, 1, 2};
+  const HashMultiSet<int> b{2, 1, 1};
+  EXPECT_EQ(a, b);
+}
+
+TEST(HashMultiSetTest, NotEqualOperator) {
+  const HashMultiSet<int> a{1, 1, 2};
+  const HashMultiSet<int> b{1, 2, 2};
+  EXPECT_NE(a, b);
+}
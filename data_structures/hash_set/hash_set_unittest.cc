@@ -1,8 +1,13 @@
 #include "hash_set.h"
 
 #include <gtest/gtest.h>
+#include <unistd.h>
 
+#include <cstdint>
+#include <cstdio>
+#include <limits>
 #include <stdexcept>
+#include <string>
 #include <utility>
 
 template <class K>
@@ -496,4 +501,61 @@ TEST(HashSetTest, NotEqualOperator) {
   const HashSet<int> a{1, 2, 3};
   const HashSet<int> b{4, 5, 6};
   EXPECT_NE(a, b);
-}
\ No newline at end of file
+}
+
+// Serialization
+
+TEST(HashSetTest, Serialize) {
+  HashSet<int> hash_set;
+  for (int i{0}; i < 1000; ++i) {
+    hash_set.Insert(i);
+  }
+  std::FILE* const file{std::tmpfile()};
+
+  hash_set.Serialize(fileno(file));
+  EXPECT_EQ(lseek(fileno(file), 0, SEEK_END),
+            sizeof(std::uint64_t) + sizeof(float) + 1000 * sizeof(int));
+  std::fclose(file);
+}
+
+TEST(HashSetTest, Deserialize) {
+  const HashSet<int> hash_set{1, 2, 3};
+  std::FILE* const file{std::tmpfile()};
+  hash_set.Serialize(fileno(file));
+  lseek(fileno(file), 0, SEEK_SET);
+
+  HashSet<int> deserialized{4};
+  deserialized.Deserialize(fileno(file));
+  EXPECT_EQ(deserialized, hash_set);
+  EXPECT_EQ(deserialized.BucketCount(), hash_set.Size());
+  std::fclose(file);
+}
+
+TEST(HashSetTest, Deserialize_LengthPrefixed) {
+  const HashSet<std::string> hash_set{"a", std::string(100, 'b'), ""};
+  std::FILE* const file{std::tmpfile()};
+  hash_set.Serialize(fileno(file));
+  lseek(fileno(file), 0, SEEK_SET);
+
+  HashSet<std::string> deserialized;
+  deserialized.Deserialize(fileno(file));
+  EXPECT_EQ(deserialized, hash_set);
+  std::fclose(file);
+}
+
+TEST(HashSetTest, Deserialize_InvalidMaxLoadFactor) {
+  const HashSet<int> hash_set{1, 2, 3};
+  for (const float max_load_factor :
+       {0.0f, -1.0f, std::numeric_limits<float>::quiet_NaN(),
+        std::numeric_limits<float>::infinity()}) {
+    std::FILE* const file{std::tmpfile()};
+    hash_set.Serialize(fileno(file));
+    pwrite(fileno(file), &max_load_factor, sizeof(float),
+           sizeof(std::uint64_t));
+    lseek(fileno(file), 0, SEEK_SET);
+
+    HashSet<int> deserialized;
+    EXPECT_THROW(deserialized.Deserialize(fileno(file)), std::runtime_error);
+    std::fclose(file);
+  }
+}
@@ -0,0 +1,317 @@
+#ifndef CPP_ALGORITHMS_DATA_STRUCTURES_MAPPED_ARRAY_MAPPED_ARRAY_H_
+#define CPP_ALGORITHMS_DATA_STRUCTURES_MAPPED_ARRAY_MAPPED_ARRAY_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "growth_policy.h"
+#include "simd.h"
+
+// Growable array of trivially copyable elements that lives in a file mapped
+// into memory, so reopening the file brings the elements back without
+// reading or parsing them. The file starts with a small header holding the
+// element count, followed by the elements. Growing extends the file with
+// ftruncate and remaps it, which like DynamicArray invalidates pointers.
+// Changes reach the file when the kernel writes the pages back, or on Sync().
+template <class T>
+class MappedArray {
+ public:
+  static_assert(std::is_trivially_copyable_v<T>,
+                "elements are stored as raw bytes");
+
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  // Constructors
+
+  // Opens the array stored at `path`, creating an empty one if the file does
+  // not exist.
+  explicit MappedArray(const std::string& path) {
+    fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ == -1) {
+      throw std::system_error(errno, std::generic_category(), "open");
+    }
+
+    try {
+      struct stat status;
+      if (fstat(fd_, &status) == -1) {
+        throw std::system_error(errno, std::generic_category(), "fstat");
+      }
+
+      const auto file_size{static_cast<std::size_t>(status.st_size)};
+      if (file_size == 0) {
+        Truncate(FileSizeFor(0));
+        Map(FileSizeFor(0));
+        header_->magic = kMagic;
+        header_->element_size = sizeof(T);
+      } else {
+        if (file_size < kHeaderSize) {
+          throw std::runtime_error("file is not a mapped array");
+        }
+        Map(file_size);
+        if (header_->magic != kMagic || header_->element_size != sizeof(T) ||
+            header_->size > Capacity()) {
+          throw std::runtime_error("file is not a mapped array of this type");
+        }
+      }
+    } catch (...) {
+      Close();
+      throw;
+    }
+  }
+
+  MappedArray(const MappedArray& other) = delete;
+
+  MappedArray(MappedArray&& other) noexcept { Swap(other); }
+
+  ~MappedArray() { Close(); }
+
+  // Assignments
+
+  MappedArray& operator=(const MappedArray& other) = delete;
+
+  MappedArray& operator=(MappedArray&& other) noexcept {
+    if (this == &other) return *this;
+
+    Close();
+    Swap(other);
+
+    return *this;
+  }
+
+  // Element access
+
+  reference At(const size_type index) {
+    return const_cast<reference>(std::as_const(*this).At(index));
+  }
+  const_reference At(const size_type index) const {
+    if (index >= Size()) throw std::out_of_range("index out of bounds");
+    return Data()[index];
+  }
+
+  reference operator[](const size_type index) { return Data()[index]; }
+  const_reference operator[](const size_type index) const {
+    return Data()[index];
+  }
+
+  reference Front() { return Data()[0]; }
+  const_reference Front() const { return Data()[0]; }
+
+  reference Back() { return Data()[Size() - 1]; }
+  const_reference Back() const { return Data()[Size() - 1]; }
+
+  pointer Data() noexcept {
+    return reinterpret_cast<T*>(mapping_ + kHeaderSize);
+  }
+  const_pointer Data() const noexcept {
+    return reinterpret_cast<const T*>(mapping_ + kHeaderSize);
+  }
+
+  // Iterators
+
+  iterator begin() noexcept { return Data(); }
+  const_iterator begin() const noexcept { return Data(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  iterator end() noexcept { return Data() + Size(); }
+  const_iterator end() const noexcept { return Data() + Size(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  // Capacity
+
+  bool Empty() const noexcept { return Size() == 0; }
+
+  size_type Size() const noexcept {
+    return header_ == nullptr ? 0 : static_cast<size_type>(header_->size);
+  }
+
+  size_type Capacity() const noexcept {
+    return header_ == nullptr ? 0 : (mapped_size_ - kHeaderSize) / sizeof(T);
+  }
+
+  void Reserve(const size_type new_capacity) {
+    if (new_capacity > Capacity()) Remap(FileSizeFor(new_capacity));
+  }
+
+  // Truncates the file to the elements in use.
+  void ShrinkToFit() { Remap(FileSizeFor(Size())); }
+
+  // Modifiers
+
+  void Clear() noexcept { header_->size = 0; }
+
+  void PushBack(const_reference value) {
+    if (Size() == Capacity()) {
+      // Copied up front, since `value` may refer to an element of the array
+      // and growing can move the mapping.
+      const T copy{value};
+      Grow();
+      Data()[Size()] = copy;
+    } else {
+      Data()[Size()] = value;
+    }
+    ++header_->size;
+  }
+
+  void PopBack() { --header_->size; }
+
+  // Like DynamicArray::Resize: new elements are value-initialized.
+  void Resize(const size_type new_size) {
+    Reserve(new_size);
+    if (new_size > Size()) {
+      std::memset(static_cast<void*>(Data() + Size()), 0,
+                  (new_size - Size()) * sizeof(T));
+    }
+    header_->size = new_size;
+  }
+
+  // Writes the changed pages back to the file and waits for the writes.
+  void Sync() {
+    if (msync(mapping_, mapped_size_, MS_SYNC) == -1) {
+      throw std::system_error(errno, std::generic_category(), "msync");
+    }
+  }
+
+  void Swap(MappedArray& other) noexcept {
+    std::swap(fd_, other.fd_);
+    std::swap(mapping_, other.mapping_);
+    std::swap(mapped_size_, other.mapped_size_);
+    std::swap(header_, other.header_);
+  }
+
+  // Comparison operators
+
+  bool operator==(const MappedArray& other) const noexcept {
+    return Size() == other.Size() && SimdEqual(Data(), other.Data(), Size());
+  }
+
+  bool operator!=(const MappedArray& other) const noexcept {
+    return !(*this == other);
+  }
+
+  // Debug
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const MappedArray& array) noexcept {
+    os << "[";
+    for (std::size_t i{0}; i < array.Size(); ++i) {
+      if (i != 0) os << ", ";
+      os << array[i];
+    }
+    os << "] (" << array.Size() << "/" << array.Capacity() << ")\n";
+    return os;
+  }
+
+ private:
+  struct Header {
+    std::uint64_t magic;
+    std::uint64_t element_size;
+    std::uint64_t size;
+  };
+
+  static constexpr std::uint64_t kMagic{0x5941525241504D4D};  // "MMAPARRY"
+  static constexpr std::size_t kHeaderSize{64};
+
+  static_assert(sizeof(Header) <= kHeaderSize && alignof(T) <= kHeaderSize,
+                "elements must stay aligned after the header");
+
+  static std::size_t PageSize() noexcept {
+    static const std::size_t page_size{
+        static_cast<std::size_t>(sysconf(_SC_PAGESIZE))};
+    return page_size;
+  }
+
+  // File size holding `capacity` elements, rounded up to whole pages.
+  static std::size_t FileSizeFor(const std::size_t capacity) noexcept {
+    const std::size_t bytes{kHeaderSize + capacity * sizeof(T)};
+    return (bytes + PageSize() - 1) / PageSize() * PageSize();
+  }
+
+  void Grow() {
+    const std::size_t new_capacity{
+        DoublingGrowth::NextCapacity(Capacity(), Size() + 1, sizeof(T))};
+    Remap(FileSizeFor(new_capacity));
+  }
+
+  void Truncate(const std::size_t file_size) {
+    if (ftruncate(fd_, static_cast<off_t>(file_size)) == -1) {
+      throw std::system_error(errno, std::generic_category(), "ftruncate");
+    }
+  }
+
+  void Map(const std::size_t size) {
+    void* const mapping{
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0)};
+    if (mapping == MAP_FAILED) {
+      throw std::system_error(errno, std::generic_category(), "mmap");
+    }
+
+    mapping_ = static_cast<unsigned char*>(mapping);
+    mapped_size_ = size;
+    header_ = reinterpret_cast<Header*>(mapping_);
+  }
+
+  // Changes the file and the mapping to `file_size` bytes. The file grows
+  // before the mapping and shrinks after it, so no mapped page is ever past
+  // the end of the file.
+  void Remap(const std::size_t file_size) {
+    const std::size_t old_size{mapped_size_};
+    if (file_size == old_size) return;
+    if (file_size > old_size) Truncate(file_size);
+
+#ifdef __linux__
+    void* const mapping{
+        mremap(mapping_, old_size, file_size, MREMAP_MAYMOVE)};
+    if (mapping == MAP_FAILED) {
+      throw std::system_error(errno, std::generic_category(), "mremap");
+    }
+    mapping_ = static_cast<unsigned char*>(mapping);
+    mapped_size_ = file_size;
+    header_ = reinterpret_cast<Header*>(mapping_);
+#else
+    munmap(mapping_, old_size);
+    mapping_ = nullptr;
+    Map(file_size);
+#endif
+
+    if (file_size < old_size) Truncate(file_size);
+  }
+
+  void Close() noexcept {
+    if (mapping_ != nullptr) munmap(mapping_, mapped_size_);
+    if (fd_ != -1) close(fd_);
+
+    fd_ = -1;
+    mapping_ = nullptr;
+    mapped_size_ = 0;
+    header_ = nullptr;
+  }
+
+  int fd_{-1};
+  unsigned char* mapping_{nullptr};
+  std::size_t mapped_size_{0};
+  Header* header_{nullptr};
+};
+
+#endif  // CPP_ALGORITHMS_DATA_STRUCTURES_MAPPED_ARRAY_MAPPED_ARRAY_H_
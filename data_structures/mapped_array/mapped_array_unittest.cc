@@ -0,0 +1,172 @@
+#include "mapped_array.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+// Path of a scratch file that is removed when the test ends.
+class MappedArrayTest : public testing::Test {
+ protected:
+  void TearDown() override { std::remove(path_.c_str()); }
+
+  const std::string path_{testing::TempDir() + "mapped_array_" +
+                          std::to_string(getpid()) + "_" +
+                          testing::UnitTest::GetInstance()
+                              ->current_test_info()
+                              ->name()};
+};
+
+struct Point {
+  std::int32_t x;
+  std::int32_t y;
+};
+
+// Constructors
+
+TEST_F(MappedArrayTest, Constructor) {
+  const MappedArray<int> array{path_};
+  EXPECT_TRUE(array.Empty());
+  EXPECT_GT(array.Capacity(), 0);
+  EXPECT_EQ(array.begin(), array.end());
+}
+
+TEST_F(MappedArrayTest, Constructor_Reopen) {
+  {
+    MappedArray<std::uint64_t> array{path_};
+    for (std::uint64_t i{0}; i < 100000; ++i) {
+      array.PushBack(i * i);
+    }
+  }
+
+  const MappedArray<std::uint64_t> array{path_};
+  ASSERT_EQ(array.Size(), 100000);
+  for (std::uint64_t i{0}; i < 100000; ++i) {
+    EXPECT_EQ(array[i], i * i);
+  }
+}
+
+TEST_F(MappedArrayTest, Constructor_WrongType) {
+  { MappedArray<std::uint64_t> array{path_}; }
+  EXPECT_THROW(MappedArray<std::uint32_t>{path_}, std::runtime_error);
+
+  std::ofstream{path_, std::ios::trunc} << "not an array";
+  EXPECT_THROW(MappedArray<std::uint64_t>{path_}, std::runtime_error);
+}
+
+TEST_F(MappedArrayTest, Constructor_MissingDirectory) {
+  EXPECT_THROW(MappedArray<int>{path_ + "/missing/array"}, std::system_error);
+}
+
+TEST_F(MappedArrayTest, MoveConstructor) {
+  MappedArray<int> array{path_};
+  array.PushBack(1);
+
+  const MappedArray<int> moved_array{std::move(array)};
+  EXPECT_EQ(moved_array.Size(), 1);
+  EXPECT_EQ(moved_array[0], 1);
+  EXPECT_TRUE(array.Empty());
+}
+
+// Element access
+
+TEST_F(MappedArrayTest, At) {
+  MappedArray<Point> array{path_};
+  array.PushBack({1, 2});
+
+  array.At(0).y = 5;
+  EXPECT_EQ(array.At(0).y, 5);
+  EXPECT_EQ(array.Front().x, 1);
+  EXPECT_EQ(array.Back().x, 1);
+  EXPECT_THROW(array.At(1), std::out_of_range);
+}
+
+// Capacity
+
+TEST_F(MappedArrayTest, Reserve) {
+  MappedArray<int> array{path_};
+
+  array.Reserve(10000);
+  EXPECT_GE(array.Capacity(), 10000);
+  EXPECT_TRUE(array.Empty());
+
+  array.PushBack(3);
+  array.ShrinkToFit();
+  EXPECT_LT(array.Capacity(), 10000);
+  EXPECT_EQ(array[0], 3);
+}
+
+// Modifiers
+
+TEST_F(MappedArrayTest, PushBack) {
+  MappedArray<int> array{path_};
+  for (int i{0}; i < 5000; ++i) {
+    array.PushBack(i);
+  }
+
+  EXPECT_EQ(array.Size(), 5000);
+  int expected{0};
+  for (const int value : array) {
+    EXPECT_EQ(value, expected++);
+  }
+
+  array.PopBack();
+  EXPECT_EQ(array.Back(), 4998);
+}
+
+TEST_F(MappedArrayTest, PushBack_SelfReference) {
+  MappedArray<std::uint64_t> array{path_};
+  array.PushBack(7);
+  while (array.Size() != array.Capacity()) {
+    array.PushBack(array.Back() + 1);
+  }
+
+  const std::size_t size{array.Size()};
+  array.PushBack(array[0]);
+  EXPECT_EQ(array.Size(), size + 1);
+  EXPECT_EQ(array.Back(), 7);
+}
+
+TEST_F(MappedArrayTest, Resize) {
+  MappedArray<int> array{path_};
+  array.PushBack(7);
+
+  array.Resize(3000);
+  EXPECT_EQ(array.Size(), 3000);
+  EXPECT_EQ(array[0], 7);
+  EXPECT_EQ(array[2999], 0);
+
+  array.Resize(1);
+  EXPECT_EQ(array.Size(), 1);
+
+  array.Clear();
+  EXPECT_TRUE(array.Empty());
+}
+
+TEST_F(MappedArrayTest, Sync) {
+  MappedArray<int> array{path_};
+  array.PushBack(42);
+  array.Sync();
+
+  const MappedArray<int> reopened{path_};
+  EXPECT_EQ(reopened, array);
+}
+
+// Debug
+
+TEST_F(MappedArrayTest, OutputOperator) {
+  MappedArray<int> array{path_};
+  array.PushBack(1);
+  array.PushBack(2);
+
+  std::ostringstream os;
+  os << array;
+  EXPECT_EQ(os.str(), "[1, 2] (2/" + std::to_string(array.Capacity()) + ")\n");
+}
@@ -9,9 +9,11 @@
 #include <utility>
 
 #include "binary_heap.h"
+#include "growth_policy.h"
 
 template <class T, class Compare = std::less<T>,
-          class Allocator = std::allocator<T>>
+          class Allocator = std::allocator<T>,
+          class GrowthPolicy = DoublingGrowth>
 class PriorityQueue {
  public:
   using value_compare = Compare;
@@ -62,6 +64,13 @@ class PriorityQueue {
 
   void Push(const value_type& value) { container_.Insert(value); }
 
+  void Push(value_type&& value) { container_.Insert(std::move(value)); }
+
+  template <class... Args>
+  void Emplace(Args&&... args) {
+    container_.Emplace(std::forward<Args>(args)...);
+  }
+
   void Pop() { container_.Pop(); }
 
   void Swap(PriorityQueue& other) { container_.Swap(other.container_); }
@@ -75,7 +84,7 @@ class PriorityQueue {
   }
 
  private:
-  BinaryHeap<T, Compare, Allocator> container_;
+  BinaryHeap<T, Compare, Allocator, GrowthPolicy> container_;
 };
 
 #endif  // CPP_ALGORITHMS_DATA_STRUCTURES_PRIORITY_QUEUE_PRIORITY_QUEUE_H_
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include <functional>
 #include <initializer_list>
+#include <string>
 #include <utility>
 
 template <class T>
@@ -133,6 +134,15 @@ TEST(PriorityQueueTest, Push) {
   EXPECT_EQ(priority_queue.Top(), 3);
 }
 
+TEST(PriorityQueueTest, Emplace) {
+  MaxPriorityQueue<std::pair<int, std::string>> priority_queue;
+
+  priority_queue.Emplace(1, "one");
+  priority_queue.Push({3, "three"});
+  priority_queue.Emplace(2, "two");
+  EXPECT_EQ(priority_queue.Top().second, "three");
+}
+
 TEST(PriorityQueueTest, Pop) {
   MaxPriorityQueue<int> max_priority_queue{1, 2, 3};
 
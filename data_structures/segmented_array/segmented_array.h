@@ -0,0 +1,423 @@
+#ifndef CPP_ALGORITHMS_DATA_STRUCTURES_SEGMENTED_ARRAY_SEGMENTED_ARRAY_H_
+#define CPP_ALGORITHMS_DATA_STRUCTURES_SEGMENTED_ARRAY_SEGMENTED_ARRAY_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "bits.h"
+#include "span.h"
+
+// Growable array whose elements never move. Storage is a fixed table of
+// chunks where chunk k holds kFirstChunkSize << k elements, so growing only
+// allocates the next chunk and pointers and references stay valid until the
+// element is popped. Index i lives in the chunk given by the highest set bit
+// of i + kFirstChunkSize, which makes indexing O(1) without a loop. Each
+// chunk is contiguous and can be processed as a span.
+template <class T, class Allocator = std::allocator<T>>
+class SegmentedArray {
+ private:
+  template <class Value>
+  class BasicIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+    using container_pointer =
+        std::conditional_t<std::is_const_v<Value>, const SegmentedArray*,
+                           SegmentedArray*>;
+
+    BasicIterator() noexcept = default;
+
+    BasicIterator(const container_pointer container,
+                  const std::size_t index) noexcept
+        : container_{container}, index_{index} {}
+
+    // Iterators convert to const iterators.
+    template <class Other,
+              class = std::enable_if_t<std::is_same_v<const Other, Value> &&
+                                       !std::is_same_v<Other, Value>>>
+    BasicIterator(const BasicIterator<Other>& other) noexcept
+        : container_{other.container_}, index_{other.index_} {}
+
+    reference operator*() const noexcept { return (*container_)[index_]; }
+
+    pointer operator->() const noexcept { return &(**this); }
+
+    reference operator[](const difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    BasicIterator& operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+
+    BasicIterator operator++(int) noexcept {
+      BasicIterator temp{*this};
+      ++(*this);
+      return temp;
+    }
+
+    BasicIterator& operator--() noexcept {
+      --index_;
+      return *this;
+    }
+
+    BasicIterator operator--(int) noexcept {
+      BasicIterator temp{*this};
+      --(*this);
+      return temp;
+    }
+
+    BasicIterator& operator+=(const difference_type n) noexcept {
+      index_ += n;
+      return *this;
+    }
+
+    BasicIterator& operator-=(const difference_type n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+
+    BasicIterator operator+(const difference_type n) const noexcept {
+      BasicIterator temp{*this};
+      return temp += n;
+    }
+
+    BasicIterator operator-(const difference_type n) const noexcept {
+      BasicIterator temp{*this};
+      return temp -= n;
+    }
+
+    difference_type operator-(const BasicIterator& other) const noexcept {
+      return static_cast<difference_type>(index_) -
+             static_cast<difference_type>(other.index_);
+    }
+
+    bool operator==(const BasicIterator& other) const noexcept {
+      return index_ == other.index_;
+    }
+
+    bool operator!=(const BasicIterator& other) const noexcept {
+      return !(*this == other);
+    }
+
+    bool operator<(const BasicIterator& other) const noexcept {
+      return index_ < other.index_;
+    }
+
+    bool operator<=(const BasicIterator& other) const noexcept {
+      return !(other < *this);
+    }
+
+    bool operator>(const BasicIterator& other) const noexcept {
+      return other < *this;
+    }
+
+    bool operator>=(const BasicIterator& other) const noexcept {
+      return !(*this < other);
+    }
+
+   private:
+    friend class SegmentedArray;
+    template <class>
+    friend class BasicIterator;
+
+    container_pointer container_{nullptr};
+    std::size_t index_{0};
+  };
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = BasicIterator<T>;
+  using const_iterator = BasicIterator<const T>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static constexpr std::size_t kFirstChunkShift{4};
+  static constexpr std::size_t kFirstChunkSize{std::size_t{1}
+                                               << kFirstChunkShift};
+  static constexpr std::size_t kMaxChunkCount{
+      std::numeric_limits<std::size_t>::digits - kFirstChunkShift};
+
+  // Constructors
+
+  SegmentedArray() noexcept = default;
+
+  SegmentedArray(const SegmentedArray& other) {
+    Reserve(other.size_);
+    for (const T& value : other) {
+      EmplaceBack(value);
+    }
+  }
+
+  SegmentedArray(SegmentedArray&& other) noexcept { Swap(other); }
+
+  SegmentedArray(const std::initializer_list<T> list) {
+    Reserve(list.size());
+    for (const T& value : list) {
+      EmplaceBack(value);
+    }
+  }
+
+  ~SegmentedArray() {
+    Clear();
+    DeallocateChunks(0);
+  }
+
+  // Assignments
+
+  SegmentedArray& operator=(const SegmentedArray& other) {
+    if (this == &other) return *this;
+
+    Clear();
+    Reserve(other.size_);
+    for (const T& value : other) {
+      EmplaceBack(value);
+    }
+
+    return *this;
+  }
+
+  SegmentedArray& operator=(SegmentedArray&& other) noexcept {
+    if (this == &other) return *this;
+
+    Clear();
+    DeallocateChunks(0);
+    Swap(other);
+
+    return *this;
+  }
+
+  SegmentedArray& operator=(const std::initializer_list<T> list) {
+    Clear();
+    Reserve(list.size());
+    for (const T& value : list) {
+      EmplaceBack(value);
+    }
+
+    return *this;
+  }
+
+  // Element access
+
+  reference At(const size_type index) {
+    return const_cast<reference>(std::as_const(*this).At(index));
+  }
+  const_reference At(const size_type index) const {
+    if (index >= size_) throw std::out_of_range("index out of bounds");
+    return (*this)[index];
+  }
+
+  reference operator[](const size_type index) {
+    return const_cast<reference>(std::as_const(*this)[index]);
+  }
+  const_reference operator[](const size_type index) const {
+    const std::size_t chunk{ChunkOf(index)};
+    return chunks_[chunk][index + kFirstChunkSize - ChunkCapacity(chunk)];
+  }
+
+  reference Front() { return (*this)[0]; }
+  const_reference Front() const { return (*this)[0]; }
+
+  reference Back() { return (*this)[size_ - 1]; }
+  const_reference Back() const { return (*this)[size_ - 1]; }
+
+  // Number of chunks holding at least one element.
+  size_type ChunkCount() const noexcept {
+    return size_ == 0 ? 0 : ChunkOf(size_ - 1) + 1;
+  }
+
+  // Elements stored in chunk `chunk`, which are contiguous in memory.
+  Span<T> Chunk(const size_type chunk) {
+    return {chunks_[chunk], ChunkSize(chunk)};
+  }
+  Span<const T> Chunk(const size_type chunk) const {
+    return {chunks_[chunk], ChunkSize(chunk)};
+  }
+
+  // Iterators
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  iterator end() noexcept { return iterator(this, size_); }
+  const_iterator end() const noexcept { return const_iterator(this, size_); }
+  const_iterator cend() const noexcept { return end(); }
+
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(end());
+  }
+  const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(begin());
+  }
+  const_reverse_iterator crend() const noexcept { return rend(); }
+
+  // Capacity
+
+  bool Empty() const noexcept { return size_ == 0; }
+
+  size_type Size() const noexcept { return size_; }
+
+  size_type Capacity() const noexcept {
+    return ChunkCapacity(allocated_chunks_) - kFirstChunkSize;
+  }
+
+  // Allocates chunks until `new_capacity` elements fit.
+  void Reserve(const size_type new_capacity) {
+    while (Capacity() < new_capacity) {
+      AllocateChunk();
+    }
+  }
+
+  // Frees the chunks past the last element.
+  void ShrinkToFit() { DeallocateChunks(ChunkCount()); }
+
+  // Modifiers
+
+  // Destroys the elements but keeps the chunks for reuse.
+  void Clear() noexcept {
+    for (std::size_t chunk{0}; chunk < ChunkCount(); ++chunk) {
+      std::destroy(chunks_[chunk], chunks_[chunk] + ChunkSize(chunk));
+    }
+    size_ = 0;
+  }
+
+  void PushBack(const_reference value) { EmplaceBack(value); }
+
+  void PushBack(T&& value) { EmplaceBack(std::move(value)); }
+
+  // Constructs the element in place. Since nothing is ever relocated, T does
+  // not need to be copyable or movable.
+  template <class... Args>
+  reference EmplaceBack(Args&&... args) {
+    if (size_ == Capacity()) AllocateChunk();
+
+    T* const slot{&(*this)[size_]};
+    ::new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+    ++size_;
+    return *slot;
+  }
+
+  void PopBack() {
+    (*this)[size_ - 1].~T();
+    --size_;
+  }
+
+  void Resize(const size_type new_size) {
+    while (size_ > new_size) {
+      PopBack();
+    }
+    Reserve(new_size);
+    while (size_ < new_size) {
+      EmplaceBack();
+    }
+  }
+
+  void Resize(const size_type new_size, const_reference value) {
+    while (size_ > new_size) {
+      PopBack();
+    }
+    Reserve(new_size);
+    while (size_ < new_size) {
+      EmplaceBack(value);
+    }
+  }
+
+  void Swap(SegmentedArray& other) noexcept {
+    std::swap(chunks_, other.chunks_);
+    std::swap(allocated_chunks_, other.allocated_chunks_);
+    std::swap(size_, other.size_);
+  }
+
+  // Comparison operators
+
+  bool operator==(const SegmentedArray& other) const noexcept {
+    return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+  }
+
+  bool operator!=(const SegmentedArray& other) const noexcept {
+    return !(*this == other);
+  }
+
+  // Debug
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const SegmentedArray& array) noexcept {
+    os << "[";
+    if (array.size_ != 0) {
+      for (std::size_t i{0}; i < array.size_ - 1; ++i) {
+        os << array[i] << ", ";
+      }
+      os << array[array.size_ - 1];
+    }
+    os << "] (" << array.size_ << ", chunks: " << array.ChunkCount() << "/"
+       << array.allocated_chunks_ << ")\n";
+    return os;
+  }
+
+ private:
+  // Capacity of chunk `chunk`, which is also the total capacity of the
+  // chunks before it plus kFirstChunkSize.
+  static constexpr std::size_t ChunkCapacity(const std::size_t chunk) noexcept {
+    return kFirstChunkSize << chunk;
+  }
+
+  static std::size_t ChunkOf(const std::size_t index) noexcept {
+    return HighestBit(index + kFirstChunkSize) - kFirstChunkShift;
+  }
+
+  std::size_t ChunkSize(const std::size_t chunk) const noexcept {
+    const std::size_t first{ChunkCapacity(chunk) - kFirstChunkSize};
+    if (size_ <= first) return 0;
+    return std::min(size_ - first, ChunkCapacity(chunk));
+  }
+
+  void AllocateChunk() {
+    if (allocated_chunks_ == kMaxChunkCount) throw std::bad_alloc();
+
+    Allocator allocator;
+    chunks_[allocated_chunks_] =
+        allocator.allocate(ChunkCapacity(allocated_chunks_));
+    ++allocated_chunks_;
+  }
+
+  void DeallocateChunks(const std::size_t keep) noexcept {
+    Allocator allocator;
+    while (allocated_chunks_ > keep) {
+      --allocated_chunks_;
+      allocator.deallocate(chunks_[allocated_chunks_],
+                           ChunkCapacity(allocated_chunks_));
+      chunks_[allocated_chunks_] = nullptr;
+    }
+  }
+
+  T* chunks_[kMaxChunkCount]{};
+  std::size_t allocated_chunks_{0};
+  std::size_t size_{0};
+};
+
+#endif  // CPP_ALGORITHMS_DATA_STRUCTURES_SEGMENTED_ARRAY_SEGMENTED_ARRAY_H_
@@ -0,0 +1,208 @@
+#include "segmented_array.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Constructors
+
+TEST(SegmentedArrayTest, Constructor) {
+  const SegmentedArray<int> segmented_array;
+  EXPECT_TRUE(segmented_array.Empty());
+  EXPECT_EQ(segmented_array.Capacity(), 0);
+  EXPECT_EQ(segmented_array.ChunkCount(), 0);
+}
+
+TEST(SegmentedArrayTest, CopyConstructor) {
+  SegmentedArray<std::string> segmented_array;
+  for (int i{0}; i < 100; ++i) {
+    segmented_array.PushBack(std::to_string(i));
+  }
+
+  const SegmentedArray<std::string> copy{segmented_array};
+  EXPECT_EQ(copy, segmented_array);
+}
+
+TEST(SegmentedArrayTest, MoveConstructor) {
+  SegmentedArray<int> segmented_array{1, 2, 3};
+  const int* const address{&segmented_array[1]};
+
+  const SegmentedArray<int> moved_array{std::move(segmented_array)};
+  EXPECT_EQ(moved_array, (SegmentedArray<int>{1, 2, 3}));
+  EXPECT_EQ(&moved_array[1], address);
+  EXPECT_TRUE(segmented_array.Empty());
+}
+
+TEST(SegmentedArrayTest, InitializerListConstructor) {
+  const SegmentedArray<int> segmented_array{1, 2, 3};
+  EXPECT_EQ(segmented_array.Size(), 3);
+  EXPECT_EQ(segmented_array[2], 3);
+}
+
+// Assignments
+
+TEST(SegmentedArrayTest, CopyAssignment) {
+  const SegmentedArray<int> segmented_array{1, 2, 3};
+  SegmentedArray<int> copy{4};
+
+  copy = segmented_array;
+  EXPECT_EQ(copy, segmented_array);
+}
+
+TEST(SegmentedArrayTest, MoveAssignment) {
+  SegmentedArray<std::string> segmented_array{"a", "b"};
+  SegmentedArray<std::string> moved_array{"c"};
+
+  moved_array = std::move(segmented_array);
+  EXPECT_EQ(moved_array, (SegmentedArray<std::string>{"a", "b"}));
+  EXPECT_TRUE(segmented_array.Empty());
+}
+
+// Element access
+
+TEST(SegmentedArrayTest, At) {
+  SegmentedArray<int> segmented_array{1, 2};
+  EXPECT_EQ(segmented_array.At(1), 2);
+  EXPECT_THROW(segmented_array.At(2), std::out_of_range);
+
+  segmented_array.At(0) = 5;
+  EXPECT_EQ(segmented_array.Front(), 5);
+  EXPECT_EQ(segmented_array.Back(), 2);
+}
+
+TEST(SegmentedArrayTest, SubscriptOperator) {
+  SegmentedArray<std::size_t> segmented_array;
+  for (std::size_t i{0}; i < 10000; ++i) {
+    segmented_array.PushBack(i);
+  }
+
+  for (std::size_t i{0}; i < 10000; ++i) {
+    EXPECT_EQ(segmented_array[i], i);
+  }
+}
+
+TEST(SegmentedArrayTest, Chunk) {
+  SegmentedArray<int> segmented_array;
+  segmented_array.Resize(100);
+  std::iota(segmented_array.begin(), segmented_array.end(), 0);
+
+  const std::size_t first{SegmentedArray<int>::kFirstChunkSize};
+  ASSERT_EQ(segmented_array.ChunkCount(), 3);
+  EXPECT_EQ(segmented_array.Chunk(0).Size(), first);
+  EXPECT_EQ(segmented_array.Chunk(1).Size(), 2 * first);
+  EXPECT_EQ(segmented_array.Chunk(2).Size(), 100 - 3 * first);
+
+  int expected{0};
+  for (std::size_t chunk{0}; chunk < segmented_array.ChunkCount(); ++chunk) {
+    for (const int value : segmented_array.Chunk(chunk)) {
+      EXPECT_EQ(value, expected++);
+    }
+  }
+  EXPECT_EQ(expected, 100);
+}
+
+// Iterators
+
+TEST(SegmentedArrayTest, Begin) {
+  SegmentedArray<int> segmented_array{1, 2, 3};
+
+  for (int& value : segmented_array) {
+    value *= 2;
+  }
+  EXPECT_EQ(segmented_array, (SegmentedArray<int>{2, 4, 6}));
+  EXPECT_EQ(segmented_array.end() - segmented_array.begin(), 3);
+  EXPECT_EQ(*segmented_array.rbegin(), 6);
+
+  SegmentedArray<int>::const_iterator it{segmented_array.begin()};
+  EXPECT_EQ(it[2], 6);
+}
+
+// Capacity
+
+TEST(SegmentedArrayTest, Reserve) {
+  SegmentedArray<int> segmented_array;
+
+  segmented_array.Reserve(17);
+  EXPECT_EQ(segmented_array.Capacity(), 48);
+  EXPECT_EQ(segmented_array.Size(), 0);
+
+  segmented_array.ShrinkToFit();
+  EXPECT_EQ(segmented_array.Capacity(), 0);
+}
+
+// Modifiers
+
+TEST(SegmentedArrayTest, PushBack_StableAddresses) {
+  SegmentedArray<std::string> segmented_array;
+  std::vector<const std::string*> addresses;
+  for (int i{0}; i < 5000; ++i) {
+    segmented_array.PushBack(std::to_string(i));
+    addresses.push_back(&segmented_array.Back());
+  }
+
+  for (int i{0}; i < 5000; ++i) {
+    EXPECT_EQ(&segmented_array[i], addresses[i]);
+    EXPECT_EQ(*addresses[i], std::to_string(i));
+  }
+}
+
+TEST(SegmentedArrayTest, EmplaceBack_Immovable) {
+  SegmentedArray<std::mutex> segmented_array;
+  std::mutex& mutex{segmented_array.EmplaceBack()};
+  for (int i{0}; i < 100; ++i) {
+    segmented_array.EmplaceBack();
+  }
+
+  EXPECT_EQ(&segmented_array.Front(), &mutex);
+  EXPECT_EQ(segmented_array.Size(), 101);
+}
+
+TEST(SegmentedArrayTest, PopBack) {
+  SegmentedArray<int> segmented_array{1, 2, 3};
+
+  segmented_array.PopBack();
+  EXPECT_EQ(segmented_array, (SegmentedArray<int>{1, 2}));
+}
+
+TEST(SegmentedArrayTest, Clear) {
+  SegmentedArray<std::string> segmented_array{"a", "b"};
+
+  segmented_array.Clear();
+  EXPECT_TRUE(segmented_array.Empty());
+  EXPECT_EQ(segmented_array.Capacity(), 16);
+}
+
+TEST(SegmentedArrayTest, Resize) {
+  SegmentedArray<int> segmented_array{1};
+
+  segmented_array.Resize(40, 7);
+  EXPECT_EQ(segmented_array.Size(), 40);
+  EXPECT_EQ(segmented_array[39], 7);
+
+  segmented_array.Resize(2);
+  EXPECT_EQ(segmented_array, (SegmentedArray<int>{1, 7}));
+}
+
+TEST(SegmentedArrayTest, Swap) {
+  SegmentedArray<int> segmented_array{1};
+  SegmentedArray<int> other{2, 3};
+
+  segmented_array.Swap(other);
+  EXPECT_EQ(segmented_array, (SegmentedArray<int>{2, 3}));
+  EXPECT_EQ(other, (SegmentedArray<int>{1}));
+}
+
+// Debug
+
+TEST(SegmentedArrayTest, OutputOperator) {
+  std::ostringstream os;
+  os << SegmentedArray<int>{1, 2};
+  EXPECT_EQ(os.str(), "[1, 2] (2, chunks: 1/1)\n");
+}
@@ -5,6 +5,7 @@
 #include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <new>
 #include <ostream>
 #include <type_traits>
 #include <utility>
@@ -117,6 +118,7 @@ class SinglyLinkedList {
   SinglyLinkedList() noexcept {
     NodeAllocator node_allocator;
     head_ = node_allocator.allocate(1);
+    head_->next = nullptr;
   }
 
   SinglyLinkedList(const SinglyLinkedList& other) : SinglyLinkedList() {
@@ -124,12 +126,12 @@ class SinglyLinkedList {
 
     size_ = other.size_;
 
-    Node<T>* prev_node{new Node<T>{other.head_->next->value}};
+    Node<T>* prev_node{CreateNode(other.head_->next->value)};
     head_->next = prev_node;
 
     Node<T>* other_node{other.head_->next->next};
     while (other_node != nullptr) {
-      Node<T>* const node{new Node<T>{other_node->value}};
+      Node<T>* const node{CreateNode(other_node->value)};
       prev_node->next = node;
       prev_node = node;
       other_node = other_node->next;
@@ -146,11 +148,11 @@ class SinglyLinkedList {
     size_ = list.size();
     const T* it{list.begin()};
 
-    Node<T>* prev_node{new Node<T>{*it}};
+    Node<T>* prev_node{CreateNode(*it)};
     head_->next = prev_node;
 
     while (++it != list.end()) {
-      Node<T>* const node{new Node<T>{*it}};
+      Node<T>* const node{CreateNode(*it)};
       prev_node->next = node;
       prev_node = node;
     }
@@ -220,7 +222,7 @@ class SinglyLinkedList {
     Node<T>* node{head_->next};
     while (node != nullptr) {
       Node<T>* const temp{node->next};
-      delete node;
+      DestroyNode(node);
       node = temp;
     }
 
@@ -241,7 +243,7 @@ class SinglyLinkedList {
 
     Node<T>* node{nullptr};
     for (std::size_t i{0}; i < count; ++i) {
-      node = new Node<T>{value};
+      node = CreateNode(value);
       prev_node->next = node;
       prev_node = node;
     }
@@ -265,7 +267,7 @@ class SinglyLinkedList {
     Node<T>* node{nullptr};
 
     for (InputIterator it{first}; it != last; ++it) {
-      node = new Node<T>{*it};
+      node = CreateNode(*it);
       prev_node->next = node;
       prev_node = node;
       ++distance;
@@ -297,7 +299,7 @@ class SinglyLinkedList {
 
     while (node != last.node_) {
       Node<T>* const next_node{node->next};
-      delete node;
+      DestroyNode(node);
       node = next_node;
       ++distance;
     }
@@ -319,7 +321,7 @@ class SinglyLinkedList {
 
     for (std::size_t i{0}; i < distance; ++i) {
       Node<T>* const next_node{node->next};
-      delete node;
+      DestroyNode(node);
       node = next_node;
     }
 
@@ -328,14 +330,14 @@ class SinglyLinkedList {
   }
 
   void PushFront(const_reference value) {
-    Node<T>* const node{new Node<T>{value, head_->next}};
+    Node<T>* const node{CreateNode(value, head_->next)};
     head_->next = node;
     size_ += 1;
   }
 
   void PopFront() {
     Node<T>* const node{head_->next->next};
-    delete head_->next;
+    DestroyNode(head_->next);
     head_->next = node;
     size_ -= 1;
   }
@@ -478,6 +480,25 @@ class SinglyLinkedList {
   using NodeAllocator =
       typename std::allocator_traits<Allocator>::template rebind_alloc<Node<T>>;
 
+  template <class... Args>
+  static Node<T>* CreateNode(Args&&... args) {
+    NodeAllocator node_allocator;
+    Node<T>* const node{node_allocator.allocate(1)};
+    try {
+      return ::new (static_cast<void*>(node))
+          Node<T>{std::forward<Args>(args)...};
+    } catch (...) {
+      node_allocator.deallocate(node, 1);
+      throw;
+    }
+  }
+
+  static void DestroyNode(Node<T>* const node) noexcept {
+    NodeAllocator node_allocator;
+    node->~Node<T>();
+    node_allocator.deallocate(node, 1);
+  }
+
   Node<T>* const NodeAt(std::size_t index) {
     return const_cast<Node<T>* const>(std::as_const(*this).NodeAt(index));
   }
@@ -0,0 +1,489 @@
+#ifndef CPP_ALGORITHMS_DATA_STRUCTURES_SMALL_DYNAMIC_ARRAY_SMALL_DYNAMIC_ARRAY_H_
+#define CPP_ALGORITHMS_DATA_STRUCTURES_SMALL_DYNAMIC_ARRAY_SMALL_DYNAMIC_ARRAY_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "growth_policy.h"
+#include "is_iterator.h"
+#include "is_trivially_relocatable.h"
+
+// Dynamic array that keeps up to `N` elements in inline storage and only
+// allocates once it outgrows them. Moving an inline array moves its elements,
+// so iterators are not preserved by moves or swaps.
+template <class T, std::size_t N, class Allocator = std::allocator<T>,
+          class GrowthPolicy = DoublingGrowth>
+class SmallDynamicArray {
+  static_assert(N > 0, "inline capacity must not be zero");
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using growth_policy = GrowthPolicy;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  // Constructors
+
+  SmallDynamicArray() noexcept {}
+
+  SmallDynamicArray(const SmallDynamicArray& other) {
+    Insert(cend(), other.cbegin(), other.cend());
+  }
+
+  SmallDynamicArray(SmallDynamicArray&& other) noexcept {
+    TakeContent(std::move(other));
+  }
+
+  SmallDynamicArray(const std::initializer_list<T> list) {
+    Insert(cend(), list);
+  }
+
+  ~SmallDynamicArray() {
+    std::destroy(begin(), end());
+    Deallocate();
+  }
+
+  // Assignments
+
+  SmallDynamicArray& operator=(const SmallDynamicArray& other) {
+    if (this == &other) return *this;
+
+    Clear();
+    Insert(cend(), other.cbegin(), other.cend());
+
+    return *this;
+  }
+
+  SmallDynamicArray& operator=(SmallDynamicArray&& other) noexcept {
+    if (this == &other) return *this;
+
+    Clear();
+    Deallocate();
+    TakeContent(std::move(other));
+
+    return *this;
+  }
+
+  SmallDynamicArray& operator=(const std::initializer_list<T> list) {
+    Clear();
+    Insert(cend(), list);
+    return *this;
+  }
+
+  // Element access
+
+  reference At(const size_type index) {
+    return const_cast<reference>(std::as_const(*this).At(index));
+  }
+  const_reference At(const size_type index) const {
+    if (index >= size_) throw std::out_of_range("index out of bounds");
+    return data_[index];
+  }
+
+  reference operator[](const size_type index) { return data_[index]; }
+  const_reference operator[](const size_type index) const {
+    return data_[index];
+  }
+
+  reference Front() { return data_[0]; }
+  const_reference Front() const { return data_[0]; }
+
+  reference Back() { return data_[size_ - 1]; }
+  const_reference Back() const { return data_[size_ - 1]; }
+
+  pointer Data() noexcept { return data_; }
+  const_pointer Data() const noexcept { return data_; }
+
+  // Iterators
+
+  iterator begin() noexcept { return data_; }
+  const_iterator begin() const noexcept { return data_; }
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  iterator end() noexcept { return data_ + size_; }
+  const_iterator end() const noexcept { return data_ + size_; }
+  const_iterator cend() const noexcept { return end(); }
+
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(end());
+  }
+  const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(begin());
+  }
+  const_reverse_iterator crend() const noexcept { return rend(); }
+
+  // Capacity
+
+  bool Empty() const noexcept { return size_ == 0; }
+
+  size_type Size() const noexcept { return size_; }
+
+  void Reserve(const size_type new_capacity) {
+    if (new_capacity <= capacity_) return;
+    ForceReserve(new_capacity);
+  }
+
+  size_type Capacity() const noexcept { return capacity_; }
+
+  bool IsInline() const noexcept { return data_ == InlineData(); }
+
+  void ShrinkToFit() {
+    if (IsInline() || capacity_ == size_) return;
+    ForceReserve(size_);
+  }
+
+  // Modifiers
+
+  void Clear() noexcept {
+    std::destroy(begin(), end());
+    size_ = 0;
+  }
+
+  iterator Insert(const const_iterator position, const_reference value) {
+    return Insert(position, 1, value);
+  }
+
+  iterator Insert(const const_iterator position, const size_type count,
+                  const_reference value) {
+    const std::size_t index{static_cast<std::size_t>(position - cbegin())};
+    if (count == 0) return begin() + index;
+
+    const std::size_t new_size{size_ + count};
+    if (new_size > capacity_) {
+      const std::size_t new_capacity{
+          GrowthPolicy::NextCapacity(capacity_, new_size, sizeof(T))};
+      T* const new_data{Allocate(new_capacity)};
+
+      std::uninitialized_fill_n(new_data + index, count, value);
+      Reallocate(new_data, new_capacity, index, count);
+    } else {
+      const T copy{value};
+      OpenGap(index, count);
+      std::uninitialized_fill_n(data_ + index, count, copy);
+    }
+
+    size_ = new_size;
+    return begin() + index;
+  }
+
+  template <class InputIterator,
+            std::enable_if_t<is_iterator<InputIterator>, bool> = true>
+  iterator Insert(const const_iterator position, const InputIterator first,
+                  const InputIterator last) {
+    const std::size_t index{static_cast<std::size_t>(position - cbegin())};
+    const std::size_t distance{
+        static_cast<std::size_t>(std::distance(first, last))};
+    if (distance == 0) return begin() + index;
+
+    const std::size_t new_size{size_ + distance};
+    if (new_size > capacity_) {
+      const std::size_t new_capacity{
+          GrowthPolicy::NextCapacity(capacity_, new_size, sizeof(T))};
+      T* const new_data{Allocate(new_capacity)};
+
+      std::uninitialized_copy(first, last, new_data + index);
+      Reallocate(new_data, new_capacity, index, distance);
+    } else {
+      OpenGap(index, distance);
+      std::uninitialized_copy(first, last, data_ + index);
+    }
+
+    size_ = new_size;
+    return begin() + index;
+  }
+
+  iterator Insert(const const_iterator position,
+                  const std::initializer_list<T> list) {
+    return Insert(position, list.begin(), list.end());
+  }
+
+  template <class... Args>
+  iterator Emplace(const const_iterator position, Args&&... args) {
+    const std::size_t index{static_cast<std::size_t>(position - cbegin())};
+    if (index == size_) {
+      EmplaceBack(std::forward<Args>(args)...);
+      return begin() + index;
+    }
+
+    // Constructed up front, since `args` may refer to elements of the array.
+    T value(std::forward<Args>(args)...);
+    if (size_ == capacity_) Grow();
+
+    OpenGap(index, 1);
+    ::new (static_cast<void*>(data_ + index)) T(std::move(value));
+    ++size_;
+
+    return begin() + index;
+  }
+
+  iterator Erase(const const_iterator position) {
+    return Erase(position, position + 1);
+  }
+
+  iterator Erase(const const_iterator first, const const_iterator last) {
+    const std::size_t first_index{static_cast<std::size_t>(first - cbegin())};
+    const std::size_t last_index{static_cast<std::size_t>(last - cbegin())};
+    const std::size_t distance{last_index - first_index};
+    if (distance == 0) return begin() + first_index;
+
+    if constexpr (is_trivially_relocatable<T>) {
+      std::destroy(data_ + first_index, data_ + last_index);
+      std::memmove(static_cast<void*>(data_ + first_index),
+                   static_cast<const void*>(data_ + last_index),
+                   (size_ - last_index) * sizeof(T));
+    } else {
+      std::move(data_ + last_index, data_ + size_, data_ + first_index);
+      std::destroy(data_ + size_ - distance, data_ + size_);
+    }
+    size_ -= distance;
+
+    return begin() + first_index;
+  }
+
+  void PushBack(const_reference value) { EmplaceBack(value); }
+
+  void PushBack(T&& value) { EmplaceBack(std::move(value)); }
+
+  template <class... Args>
+  reference EmplaceBack(Args&&... args) {
+    if (size_ == capacity_) {
+      T value(std::forward<Args>(args)...);
+      Grow();
+      ::new (static_cast<void*>(data_ + size_)) T(std::move(value));
+    } else {
+      ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+    }
+
+    return data_[size_++];
+  }
+
+  void PopBack() {
+    data_[size_ - 1].~T();
+    --size_;
+  }
+
+  void Resize(const size_type new_size) {
+    if (new_size <= size_) {
+      Erase(cbegin() + new_size, cend());
+      return;
+    }
+
+    if (new_size > capacity_)
+      ForceReserve(GrowthPolicy::NextCapacity(capacity_, new_size, sizeof(T)));
+    std::uninitialized_value_construct(data_ + size_, data_ + new_size);
+    size_ = new_size;
+  }
+
+  void Resize(const size_type new_size, const_reference value) {
+    if (new_size < size_) {
+      Erase(cbegin() + new_size, cend());
+    } else {
+      Insert(cend(), new_size - size_, value);
+    }
+  }
+
+  void Swap(SmallDynamicArray& other) noexcept {
+    if (!IsInline() && !other.IsInline()) {
+      std::swap(data_, other.data_);
+      std::swap(capacity_, other.capacity_);
+      std::swap(size_, other.size_);
+      return;
+    }
+
+    SmallDynamicArray temp{std::move(other)};
+    other = std::move(*this);
+    *this = std::move(temp);
+  }
+
+  // Comparison operators
+
+  bool operator==(const SmallDynamicArray& other) const noexcept {
+    if (size_ != other.size_) return false;
+
+    for (std::size_t i{0}; i < size_; ++i) {
+      if ((*this)[i] != other[i]) return false;
+    }
+    return true;
+  }
+
+  bool operator!=(const SmallDynamicArray& other) const noexcept {
+    return !(*this == other);
+  }
+
+  bool operator<(const SmallDynamicArray& other) const noexcept {
+    if (size_ != other.size_) return size_ < other.size_;
+
+    for (std::size_t i{0}; i < other.size_; ++i) {
+      if (!((*this)[i] < other[i])) return false;
+    }
+    return true;
+  }
+
+  bool operator<=(const SmallDynamicArray& other) const noexcept {
+    return !(*this > other);
+  }
+
+  bool operator>(const SmallDynamicArray& other) const noexcept {
+    return other < *this;
+  }
+
+  bool operator>=(const SmallDynamicArray& other) const noexcept {
+    return !(*this < other);
+  }
+
+  // Debug
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const SmallDynamicArray& array) noexcept {
+    os << "[";
+    if (array.size_ != 0) {
+      for (std::size_t i{0}; i < array.size_ - 1; ++i) {
+        os << array[i] << ", ";
+      }
+      os << array[array.size_ - 1];
+    }
+    os << "] (" << array.size_ << ", cap: " << array.capacity_
+       << (array.IsInline() ? ", inline" : "") << ")\n";
+    return os;
+  }
+
+ private:
+  T* InlineData() noexcept { return reinterpret_cast<T*>(storage_); }
+  const T* InlineData() const noexcept {
+    return reinterpret_cast<const T*>(storage_);
+  }
+
+  T* Allocate(const std::size_t capacity) {
+    if (capacity <= N) return InlineData();
+
+    Allocator allocator;
+    return allocator.allocate(capacity);
+  }
+
+  void Deallocate() noexcept {
+    if (IsInline()) return;
+
+    Allocator allocator;
+    allocator.deallocate(data_, capacity_);
+    data_ = InlineData();
+    capacity_ = N;
+  }
+
+  void Grow() {
+    ForceReserve(GrowthPolicy::NextCapacity(capacity_, size_ + 1, sizeof(T)));
+  }
+
+  void ForceReserve(const std::size_t new_capacity) {
+    if (new_capacity <= N) {
+      if (IsInline()) return;
+
+      // Relocate within the object before giving the heap block back.
+      T* const old_data{data_};
+      const std::size_t old_capacity{capacity_};
+      Relocate(old_data, size_, InlineData());
+      data_ = InlineData();
+      capacity_ = N;
+
+      Allocator allocator;
+      allocator.deallocate(old_data, old_capacity);
+      return;
+    }
+
+    T* const new_data{Allocate(new_capacity)};
+    Relocate(data_, size_, new_data);
+    Deallocate();
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  // Moves the current elements into `new_data`, leaving a gap of `count`
+  // already constructed elements at `index`, and adopts the new block.
+  void Reallocate(T* const new_data, const std::size_t new_capacity,
+                  const std::size_t index, const std::size_t count) {
+    Relocate(data_, index, new_data);
+    Relocate(data_ + index, size_ - index, new_data + index + count);
+    Deallocate();
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  // Shifts [index, size) right by `count` within the capacity and leaves
+  // [index, index + count) uninitialized.
+  void OpenGap(const std::size_t index, const std::size_t count) {
+    if constexpr (is_trivially_relocatable<T>) {
+      std::memmove(static_cast<void*>(data_ + index + count),
+                   static_cast<const void*>(data_ + index),
+                   (size_ - index) * sizeof(T));
+    } else {
+      const std::size_t tail{size_ - index};
+      if (count >= tail) {
+        std::uninitialized_move(data_ + index, data_ + size_,
+                                data_ + index + count);
+        std::destroy(data_ + index, data_ + size_);
+      } else {
+        std::uninitialized_move(data_ + size_ - count, data_ + size_,
+                                data_ + size_);
+        std::move_backward(data_ + index, data_ + size_ - count,
+                           data_ + size_);
+        std::destroy(data_ + index, data_ + index + count);
+      }
+    }
+  }
+
+  static void Relocate(T* const first, const std::size_t count,
+                       T* const destination) {
+    if constexpr (is_trivially_relocatable<T>) {
+      if (count == 0) return;
+      std::memcpy(static_cast<void*>(destination),
+                  static_cast<const void*>(first), count * sizeof(T));
+    } else {
+      std::uninitialized_move(first, first + count, destination);
+      std::destroy(first, first + count);
+    }
+  }
+
+  void TakeContent(SmallDynamicArray&& other) noexcept {
+    if (other.IsInline()) {
+      Relocate(other.data_, other.size_, data_);
+      size_ = other.size_;
+      other.size_ = 0;
+      return;
+    }
+
+    data_ = other.data_;
+    capacity_ = other.capacity_;
+    size_ = other.size_;
+    other.data_ = other.InlineData();
+    other.capacity_ = N;
+    other.size_ = 0;
+  }
+
+  alignas(T) unsigned char storage_[N * sizeof(T)];
+  T* data_{InlineData()};
+  std::size_t capacity_{N};
+  std::size_t size_{0};
+};
+
+#endif  // CPP_ALGORITHMS_DATA_STRUCTURES_SMALL_DYNAMIC_ARRAY_SMALL_DYNAMIC_ARRAY_H_
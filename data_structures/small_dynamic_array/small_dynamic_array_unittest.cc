@@ -0,0 +1,286 @@
+#include "small_dynamic_array.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+template <class T>
+using SmallArray = SmallDynamicArray<T, 4>;
+
+const std::string kLongString(64, 'x');
+
+// Constructors
+
+TEST(SmallDynamicArrayTest, Constructor) {
+  const SmallArray<int> small_array;
+  EXPECT_EQ(small_array.Size(), 0);
+  EXPECT_EQ(small_array.Capacity(), 4);
+  EXPECT_TRUE(small_array.IsInline());
+}
+
+TEST(SmallDynamicArrayTest, CopyConstructor) {
+  const SmallArray<int> small_array{1, 2, 3};
+  const SmallArray<int> copy{small_array};
+  EXPECT_EQ(copy, small_array);
+  EXPECT_TRUE(copy.IsInline());
+
+  const SmallArray<int> large_array{1, 2, 3, 4, 5};
+  const SmallArray<int> large_copy{large_array};
+  EXPECT_EQ(large_copy, large_array);
+  EXPECT_FALSE(large_copy.IsInline());
+}
+
+TEST(SmallDynamicArrayTest, MoveConstructor) {
+  SmallArray<std::string> small_array{"one", kLongString};
+  const SmallArray<std::string> moved_array{std::move(small_array)};
+  EXPECT_EQ(moved_array, (SmallArray<std::string>{"one", kLongString}));
+  EXPECT_TRUE(small_array.Empty());
+
+  SmallArray<int> large_array{1, 2, 3, 4, 5};
+  const int* const data{large_array.Data()};
+  const SmallArray<int> moved_large_array{std::move(large_array)};
+  EXPECT_EQ(moved_large_array.Data(), data);
+  EXPECT_TRUE(large_array.Empty());
+  EXPECT_TRUE(large_array.IsInline());
+}
+
+TEST(SmallDynamicArrayTest, InitializerListConstructor) {
+  const SmallArray<int> small_array{1, 2, 3, 4};
+  EXPECT_EQ(small_array.Size(), 4);
+  EXPECT_TRUE(small_array.IsInline());
+  EXPECT_EQ(small_array[3], 4);
+}
+
+// Assignments
+
+TEST(SmallDynamicArrayTest, CopyAssignment) {
+  const SmallArray<std::string> small_array{"one", kLongString};
+  SmallArray<std::string> copy{"a", "b", "c", "d", "e"};
+
+  copy = small_array;
+  EXPECT_EQ(copy, small_array);
+}
+
+TEST(SmallDynamicArrayTest, MoveAssignment) {
+  SmallArray<int> small_array{1, 2};
+  SmallArray<int> moved_array{1, 2, 3, 4, 5, 6};
+
+  moved_array = std::move(small_array);
+  EXPECT_EQ(moved_array, (SmallArray<int>{1, 2}));
+  EXPECT_TRUE(moved_array.IsInline());
+  EXPECT_TRUE(small_array.Empty());
+}
+
+TEST(SmallDynamicArrayTest, InitializerListAssignment) {
+  SmallArray<int> small_array{1};
+
+  small_array = {4, 5, 6, 7, 8};
+  EXPECT_EQ(small_array, (SmallArray<int>{4, 5, 6, 7, 8}));
+}
+
+// Element access
+
+TEST(SmallDynamicArrayTest, At) {
+  SmallArray<int> small_array{1, 2, 3};
+  EXPECT_EQ(small_array.At(2), 3);
+  EXPECT_THROW(small_array.At(3), std::out_of_range);
+
+  small_array.At(0) = 4;
+  EXPECT_EQ(small_array.Front(), 4);
+  EXPECT_EQ(small_array.Back(), 3);
+}
+
+// Iterators
+
+TEST(SmallDynamicArrayTest, Begin) {
+  SmallArray<int> small_array{1, 2, 3};
+
+  int sum{0};
+  for (const int value : small_array) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, 6);
+  EXPECT_EQ(*small_array.rbegin(), 3);
+  EXPECT_EQ(small_array.end() - small_array.begin(), 3);
+}
+
+// Capacity
+
+TEST(SmallDynamicArrayTest, Capacity) {
+  SmallArray<int> small_array;
+  for (int i{0}; i < 4; ++i) {
+    small_array.PushBack(i);
+  }
+  EXPECT_EQ(small_array.Capacity(), 4);
+  EXPECT_TRUE(small_array.IsInline());
+
+  small_array.PushBack(4);
+  EXPECT_EQ(small_array.Capacity(), 8);
+  EXPECT_FALSE(small_array.IsInline());
+}
+
+TEST(SmallDynamicArrayTest, Reserve) {
+  SmallArray<int> small_array{1, 2};
+
+  small_array.Reserve(3);
+  EXPECT_TRUE(small_array.IsInline());
+
+  small_array.Reserve(10);
+  EXPECT_EQ(small_array.Capacity(), 10);
+  EXPECT_EQ(small_array, (SmallArray<int>{1, 2}));
+}
+
+TEST(SmallDynamicArrayTest, ShrinkToFit) {
+  SmallArray<std::string> small_array{"a", "b", "c", "d", kLongString};
+
+  small_array.ShrinkToFit();
+  EXPECT_EQ(small_array.Capacity(), 5);
+
+  small_array.PopBack();
+  small_array.PopBack();
+  small_array.ShrinkToFit();
+  EXPECT_TRUE(small_array.IsInline());
+  EXPECT_EQ(small_array, (SmallArray<std::string>{"a", "b", "c"}));
+}
+
+// Modifiers
+
+TEST(SmallDynamicArrayTest, Clear) {
+  SmallArray<int> small_array{1, 2, 3, 4, 5};
+
+  small_array.Clear();
+  EXPECT_TRUE(small_array.Empty());
+  EXPECT_EQ(small_array.Capacity(), 8);
+}
+
+TEST(SmallDynamicArrayTest, Insert_Value) {
+  SmallArray<std::string> small_array{"a", "c"};
+
+  auto inserted{small_array.Insert(small_array.cbegin() + 1, "b")};
+  EXPECT_EQ(*inserted, "b");
+  inserted = small_array.Insert(small_array.cbegin(), small_array[2]);
+  EXPECT_EQ(*inserted, "c");
+  EXPECT_EQ(small_array, (SmallArray<std::string>{"c", "a", "b", "c"}));
+
+  inserted = small_array.Insert(small_array.cend() - 1, kLongString);
+  EXPECT_EQ(*inserted, kLongString);
+  EXPECT_EQ(small_array,
+            (SmallArray<std::string>{"c", "a", "b", kLongString, "c"}));
+}
+
+TEST(SmallDynamicArrayTest, Insert_ValueCount) {
+  SmallArray<std::string> small_array{"a", "b", "c"};
+
+  small_array.Insert(small_array.cbegin() + 1, 3, "x");
+  EXPECT_EQ(small_array,
+            (SmallArray<std::string>{"a", "x", "x", "x", "b", "c"}));
+
+  small_array.Insert(small_array.cbegin() + 5, 1, "y");
+  EXPECT_EQ(small_array,
+            (SmallArray<std::string>{"a", "x", "x", "x", "b", "y", "c"}));
+}
+
+TEST(SmallDynamicArrayTest, Insert_Range) {
+  SmallArray<int> small_array{1, 5};
+  const int values[]{2, 3, 4};
+
+  small_array.Insert(small_array.cbegin() + 1, values, values + 2);
+  EXPECT_EQ(small_array, (SmallArray<int>{1, 2, 3, 5}));
+
+  small_array.Insert(small_array.cbegin() + 3, {4, 4});
+  EXPECT_EQ(small_array, (SmallArray<int>{1, 2, 3, 4, 4, 5}));
+}
+
+TEST(SmallDynamicArrayTest, Erase) {
+  SmallArray<std::string> small_array{"a", "b", "c", "d", "e"};
+
+  auto next{small_array.Erase(small_array.cbegin() + 1)};
+  EXPECT_EQ(*next, "c");
+
+  next = small_array.Erase(small_array.cbegin() + 1, small_array.cend());
+  EXPECT_EQ(next, small_array.end());
+  EXPECT_EQ(small_array, (SmallArray<std::string>{"a"}));
+}
+
+TEST(SmallDynamicArrayTest, PushBack) {
+  SmallArray<std::string> small_array;
+  for (int i{0}; i < 20; ++i) {
+    small_array.PushBack(std::to_string(i));
+  }
+  small_array.PushBack(small_array.Front());
+
+  EXPECT_EQ(small_array.Size(), 21);
+  EXPECT_EQ(small_array[19], "19");
+  EXPECT_EQ(small_array.Back(), "0");
+}
+
+TEST(SmallDynamicArrayTest, EmplaceBack) {
+  SmallArray<std::unique_ptr<int>> small_array;
+
+  for (int i{0}; i < 6; ++i) {
+    small_array.EmplaceBack(std::make_unique<int>(i));
+  }
+  small_array.PushBack(std::make_unique<int>(6));
+  EXPECT_EQ(*small_array.Back(), 6);
+  EXPECT_EQ(*small_array.Front(), 0);
+}
+
+TEST(SmallDynamicArrayTest, Emplace) {
+  SmallArray<std::string> small_array{"a", "c"};
+
+  small_array.Emplace(small_array.cbegin() + 1, 2, 'b');
+  small_array.Emplace(small_array.cbegin(), small_array.Back());
+  small_array.Emplace(small_array.cend(), "d");
+  EXPECT_EQ(small_array, (SmallArray<std::string>{"c", "a", "bb", "c", "d"}));
+}
+
+TEST(SmallDynamicArrayTest, Resize) {
+  SmallArray<int> small_array{1, 2};
+
+  small_array.Resize(6, 7);
+  EXPECT_EQ(small_array, (SmallArray<int>{1, 2, 7, 7, 7, 7}));
+
+  small_array.Resize(1);
+  EXPECT_EQ(small_array, (SmallArray<int>{1}));
+
+  small_array.Resize(3);
+  EXPECT_EQ(small_array, (SmallArray<int>{1, 0, 0}));
+}
+
+TEST(SmallDynamicArrayTest, Swap) {
+  SmallArray<std::string> a{"one"};
+  SmallArray<std::string> b{"a", "b", "c", "d", kLongString};
+
+  a.Swap(b);
+  EXPECT_EQ(a, (SmallArray<std::string>{"a", "b", "c", "d", kLongString}));
+  EXPECT_EQ(b, (SmallArray<std::string>{"one"}));
+
+  SmallArray<std::string> c{"1", "2", "3", "4", "5"};
+  a.Swap(c);
+  EXPECT_EQ(a.Back(), "5");
+  EXPECT_EQ(c.Back(), kLongString);
+}
+
+// Comparison operators
+
+TEST(SmallDynamicArrayTest, EqualOperator) {
+  EXPECT_EQ((SmallArray<int>{1, 2, 3}), (SmallArray<int>{1, 2, 3}));
+  EXPECT_NE((SmallArray<int>{1, 2, 3}), (SmallArray<int>{1, 2}));
+}
+
+TEST(SmallDynamicArrayTest, LessOperator) {
+  EXPECT_LT((SmallArray<int>{1, 2}), (SmallArray<int>{1, 2, 3}));
+  EXPECT_GE((SmallArray<int>{2, 3}), (SmallArray<int>{1, 2}));
+}
+
+// Debug
+
+TEST(SmallDynamicArrayTest, OutputOperator) {
+  std::ostringstream os;
+  os << SmallArray<int>{1, 2};
+  EXPECT_EQ(os.str(), "[1, 2] (2, cap: 4, inline)\n");
+}
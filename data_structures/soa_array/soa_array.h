@@ -0,0 +1,509 @@
+#ifndef CPP_ALGORITHMS_DATA_STRUCTURES_SOA_ARRAY_SOA_ARRAY_H_
+#define CPP_ALGORITHMS_DATA_STRUCTURES_SOA_ARRAY_SOA_ARRAY_H_
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "growth_policy.h"
+#include "is_trivially_relocatable.h"
+#include "simd.h"
+#include "span.h"
+
+// Growable array of records stored as a structure of arrays: every field has
+// its own contiguous column, and all columns share one size and capacity.
+// Scanning a field only reads that column, and Field<I>() hands it out as a
+// span. Rows are accessed through tuples of references into the columns.
+template <class... Fields>
+class SoaArray {
+  static_assert(sizeof...(Fields) > 0, "records need at least one field");
+
+ private:
+  template <bool Const>
+  class BasicIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::tuple<Fields...>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<Const, std::tuple<const Fields&...>,
+                                         std::tuple<Fields&...>>;
+    using container_pointer =
+        std::conditional_t<Const, const SoaArray*, SoaArray*>;
+
+    struct pointer {
+      const reference* operator->() const noexcept { return &row; }
+
+      reference row;
+    };
+
+    BasicIterator() noexcept = default;
+
+    BasicIterator(const container_pointer container,
+                  const std::size_t index) noexcept
+        : container_{container}, index_{index} {}
+
+    // Iterators convert to const iterators.
+    template <bool OtherConst, class = std::enable_if_t<Const && !OtherConst>>
+    BasicIterator(const BasicIterator<OtherConst>& other) noexcept
+        : container_{other.container_}, index_{other.index_} {}
+
+    reference operator*() const noexcept { return (*container_)[index_]; }
+
+    pointer operator->() const noexcept { return {**this}; }
+
+    reference operator[](const difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    BasicIterator& operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+
+    BasicIterator operator++(int) noexcept {
+      BasicIterator temp{*this};
+      ++(*this);
+      return temp;
+    }
+
+    BasicIterator& operator--() noexcept {
+      --index_;
+      return *this;
+    }
+
+    BasicIterator operator--(int) noexcept {
+      BasicIterator temp{*this};
+      --(*this);
+      return temp;
+    }
+
+    BasicIterator& operator+=(const difference_type n) noexcept {
+      index_ += n;
+      return *this;
+    }
+
+    BasicIterator& operator-=(const difference_type n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+
+    BasicIterator operator+(const difference_type n) const noexcept {
+      BasicIterator temp{*this};
+      return temp += n;
+    }
+
+    BasicIterator operator-(const difference_type n) const noexcept {
+      BasicIterator temp{*this};
+      return temp -= n;
+    }
+
+    difference_type operator-(const BasicIterator& other) const noexcept {
+      return static_cast<difference_type>(index_) -
+             static_cast<difference_type>(other.index_);
+    }
+
+    bool operator==(const BasicIterator& other) const noexcept {
+      return index_ == other.index_;
+    }
+
+    bool operator!=(const BasicIterator& other) const noexcept {
+      return !(*this == other);
+    }
+
+    bool operator<(const BasicIterator& other) const noexcept {
+      return index_ < other.index_;
+    }
+
+   private:
+    friend class SoaArray;
+    template <bool>
+    friend class BasicIterator;
+
+    container_pointer container_{nullptr};
+    std::size_t index_{0};
+  };
+
+ public:
+  using value_type = std::tuple<Fields...>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::tuple<Fields&...>;
+  using const_reference = std::tuple<const Fields&...>;
+  using iterator = BasicIterator<false>;
+  using const_iterator = BasicIterator<true>;
+
+  template <std::size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+  static constexpr std::size_t kFieldCount{sizeof...(Fields)};
+
+  // Constructors
+
+  SoaArray() noexcept = default;
+
+  SoaArray(const SoaArray& other) { CopyFrom(other); }
+
+  SoaArray(SoaArray&& other) noexcept { Swap(other); }
+
+  SoaArray(const std::initializer_list<value_type> list) {
+    Reserve(list.size());
+    for (const value_type& row : list) {
+      PushBack(row);
+    }
+  }
+
+  ~SoaArray() {
+    Clear();
+    Deallocate(columns_, capacity_);
+  }
+
+  // Assignments
+
+  SoaArray& operator=(const SoaArray& other) {
+    if (this == &other) return *this;
+
+    Clear();
+    CopyFrom(other);
+
+    return *this;
+  }
+
+  SoaArray& operator=(SoaArray&& other) noexcept {
+    if (this == &other) return *this;
+
+    Clear();
+    Swap(other);
+
+    return *this;
+  }
+
+  // Element access
+
+  reference At(const size_type index) {
+    if (index >= size_) throw std::out_of_range("index out of bounds");
+    return (*this)[index];
+  }
+  const_reference At(const size_type index) const {
+    if (index >= size_) throw std::out_of_range("index out of bounds");
+    return (*this)[index];
+  }
+
+  reference operator[](const size_type index) noexcept {
+    return std::apply(
+        [index](Fields* const... columns) {
+          return reference{columns[index]...};
+        },
+        columns_);
+  }
+  const_reference operator[](const size_type index) const noexcept {
+    return std::apply(
+        [index](Fields* const... columns) {
+          return const_reference{columns[index]...};
+        },
+        columns_);
+  }
+
+  reference Front() { return (*this)[0]; }
+  const_reference Front() const { return (*this)[0]; }
+
+  reference Back() { return (*this)[size_ - 1]; }
+  const_reference Back() const { return (*this)[size_ - 1]; }
+
+  // The column holding field `I` of every record.
+  template <std::size_t I>
+  Span<field_type<I>> Field() noexcept {
+    return {std::get<I>(columns_), size_};
+  }
+  template <std::size_t I>
+  Span<const field_type<I>> Field() const noexcept {
+    return {std::get<I>(columns_), size_};
+  }
+
+  // Iterators
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  iterator end() noexcept { return iterator(this, size_); }
+  const_iterator end() const noexcept { return const_iterator(this, size_); }
+  const_iterator cend() const noexcept { return end(); }
+
+  // Capacity
+
+  bool Empty() const noexcept { return size_ == 0; }
+
+  size_type Size() const noexcept { return size_; }
+
+  size_type Capacity() const noexcept { return capacity_; }
+
+  void Reserve(const size_type new_capacity) {
+    if (new_capacity > capacity_) Reallocate(new_capacity);
+  }
+
+  void ShrinkToFit() {
+    if (size_ < capacity_) Reallocate(size_);
+  }
+
+  // Modifiers
+
+  void Clear() noexcept {
+    ForEachColumn([this](auto* const column) {
+      std::destroy(column, column + size_);
+    });
+    size_ = 0;
+  }
+
+  void PushBack(const value_type& row) {
+    std::apply([this](const Fields&... fields) { EmplaceBack(fields...); },
+               row);
+  }
+
+  void PushBack(value_type&& row) {
+    std::apply(
+        [this](Fields&... fields) { EmplaceBack(std::move(fields)...); },
+        row);
+  }
+
+  // Constructs each field of the new record from the matching argument.
+  template <class... Args>
+  reference EmplaceBack(Args&&... args) {
+    static_assert(sizeof...(Args) == kFieldCount,
+                  "one argument is needed per field");
+
+    if (size_ == capacity_) {
+      // Constructed up front, since `args` may refer to elements of the
+      // array.
+      value_type row(std::forward<Args>(args)...);
+      Reallocate(DoublingGrowth::NextCapacity(capacity_, size_ + 1,
+                                              RowSize()));
+      std::apply(
+          [this](Fields&... fields) {
+            ConstructRow(std::index_sequence_for<Fields...>{},
+                         std::move(fields)...);
+          },
+          row);
+    } else {
+      ConstructRow(std::index_sequence_for<Fields...>{},
+                   std::forward<Args>(args)...);
+    }
+    ++size_;
+    return Back();
+  }
+
+  void PopBack() {
+    --size_;
+    ForEachColumn(
+        [this](auto* const column) { std::destroy_at(column + size_); });
+  }
+
+  void Resize(const size_type new_size) {
+    if (new_size < size_) {
+      ForEachColumn([this, new_size](auto* const column) {
+        std::destroy(column + new_size, column + size_);
+      });
+    } else if (new_size > size_) {
+      Reserve(new_size);
+      ForEachColumn([this, new_size](auto* const column) {
+        std::uninitialized_value_construct(column + size_, column + new_size);
+      });
+    }
+    size_ = new_size;
+  }
+
+  void Swap(SoaArray& other) noexcept {
+    std::swap(columns_, other.columns_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+  // Comparison operators
+
+  bool operator==(const SoaArray& other) const noexcept {
+    return size_ == other.size_ &&
+           EqualColumns(other, std::index_sequence_for<Fields...>{});
+  }
+
+  bool operator!=(const SoaArray& other) const noexcept {
+    return !(*this == other);
+  }
+
+  // Debug
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const SoaArray& array) noexcept {
+    os << "[";
+    for (std::size_t i{0}; i < array.size_; ++i) {
+      if (i != 0) os << ", ";
+      os << "(";
+      std::apply(
+          [&os](const Fields&... fields) {
+            std::size_t field{0};
+            ((os << (field++ == 0 ? "" : ", ") << fields), ...);
+          },
+          array[i]);
+      os << ")";
+    }
+    os << "] (" << array.size_ << ")\n";
+    return os;
+  }
+
+ private:
+  using Columns = std::tuple<Fields*...>;
+
+  static constexpr std::size_t RowSize() noexcept {
+    return (sizeof(Fields) + ...);
+  }
+
+  template <class Function>
+  void ForEachColumn(Function&& function) {
+    std::apply(
+        [&function](Fields* const... columns) { (function(columns), ...); },
+        columns_);
+  }
+
+  template <std::size_t... Is, class... Args>
+  void ConstructRow(std::index_sequence<Is...>, Args&&... args) {
+    std::size_t constructed{0};
+    try {
+      ((::new (static_cast<void*>(std::get<Is>(columns_) + size_))
+            field_type<Is>(std::forward<Args>(args)),
+        ++constructed),
+       ...);
+    } catch (...) {
+      ((Is < constructed ? std::destroy_at(std::get<Is>(columns_) + size_)
+                         : void()),
+       ...);
+      throw;
+    }
+  }
+
+  template <std::size_t... Is>
+  bool EqualColumns(const SoaArray& other,
+                    std::index_sequence<Is...>) const noexcept {
+    return (SimdEqual(std::get<Is>(columns_), std::get<Is>(other.columns_),
+                      size_) &&
+            ...);
+  }
+
+  void CopyFrom(const SoaArray& other) {
+    Reserve(other.size_);
+    for (std::size_t i{0}; i < other.size_; ++i) {
+      std::apply([this](const Fields&... fields) { EmplaceBack(fields...); },
+                 other[i]);
+    }
+  }
+
+  // Moves every column into a new allocation of `new_capacity` records. All
+  // columns are allocated first so that a failed allocation changes nothing.
+  void Reallocate(const std::size_t new_capacity) {
+    Columns new_columns{};
+    try {
+      Allocate(new_columns, new_capacity);
+    } catch (...) {
+      Deallocate(new_columns, new_capacity);
+      throw;
+    }
+
+    try {
+      RelocateColumns(new_columns, std::index_sequence_for<Fields...>{});
+    } catch (...) {
+      Deallocate(new_columns, new_capacity);
+      throw;
+    }
+    Deallocate(columns_, capacity_);
+    columns_ = new_columns;
+    capacity_ = new_capacity;
+  }
+
+  static void Allocate(Columns& columns, const std::size_t capacity) {
+    std::apply(
+        [capacity](auto*&... column) {
+          (AllocateColumn(column, capacity), ...);
+        },
+        columns);
+  }
+
+  static void Deallocate(Columns& columns, const std::size_t capacity) {
+    std::apply(
+        [capacity](auto*&... column) {
+          (DeallocateColumn(column, capacity), ...);
+        },
+        columns);
+  }
+
+  template <class T>
+  static void AllocateColumn(T*& column, const std::size_t capacity) {
+    column = std::allocator<T>{}.allocate(capacity);
+  }
+
+  template <class T>
+  static void DeallocateColumn(T* const column, const std::size_t capacity) {
+    if (column != nullptr) std::allocator<T>{}.deallocate(column, capacity);
+  }
+
+  // Builds every column in `destination` before destroying any original, so
+  // that an exception leaves the array as it was. Columns already built are
+  // destroyed again on failure.
+  template <std::size_t... Is>
+  void RelocateColumns(Columns& destination, std::index_sequence<Is...>) {
+    std::size_t built{0};
+    try {
+      ((MoveColumn(std::get<Is>(columns_), size_, std::get<Is>(destination)),
+        ++built),
+       ...);
+    } catch (...) {
+      ((Is < built ? DestroyColumn(std::get<Is>(destination), size_) : void()),
+       ...);
+      throw;
+    }
+    (DestroyColumn(std::get<Is>(columns_), size_), ...);
+  }
+
+  // Whether every column can be relocated without throwing. Otherwise
+  // columns are copied where possible, since a moved-from column could not
+  // be restored once a later one throws.
+  static constexpr bool kNothrowRelocate{
+      ((is_trivially_relocatable<Fields> ||
+        std::is_nothrow_move_constructible_v<Fields>) &&
+       ...)};
+
+  // Moves `count` elements into uninitialized memory at `destination`, or
+  // copies them when some column could throw while relocating.
+  template <class T>
+  static void MoveColumn(T* const first, const std::size_t count,
+                         T* const destination) {
+    if constexpr (is_trivially_relocatable<T>) {
+      if (count == 0) return;
+      std::memcpy(static_cast<void*>(destination),
+                  static_cast<const void*>(first), count * sizeof(T));
+    } else if constexpr (kNothrowRelocate || !std::is_copy_constructible_v<T>) {
+      std::uninitialized_move(first, first + count, destination);
+    } else {
+      std::uninitialized_copy(first, first + count, destination);
+    }
+  }
+
+  // Ends the lifetime of a column left behind by MoveColumn. A column copied
+  // bytewise is not destroyed: either copy can own the elements, not both.
+  template <class T>
+  static void DestroyColumn(T* const first, const std::size_t count) noexcept {
+    if constexpr (!is_trivially_relocatable<T>) {
+      std::destroy(first, first + count);
+    }
+  }
+
+  Columns columns_{};
+  std::size_t size_{0};
+  std::size_t capacity_{0};
+};
+
+#endif  // CPP_ALGORITHMS_DATA_STRUCTURES_SOA_ARRAY_SOA_ARRAY_H_
@@ -0,0 +1,236 @@
+#include "soa_array.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+using Records = SoaArray<int, double, std::string>;
+
+struct ThrowingCopy {
+  ThrowingCopy(const int value) : value{value} {}
+  ThrowingCopy(const ThrowingCopy& other) : value{other.value} {
+    if (throw_on_copy) throw std::runtime_error("copy failed");
+  }
+  ThrowingCopy& operator=(const ThrowingCopy& other) = default;
+
+  static inline bool throw_on_copy{false};
+  int value;
+};
+
+// Constructors
+
+TEST(SoaArrayTest, Constructor) {
+  const Records records;
+  EXPECT_TRUE(records.Empty());
+  EXPECT_EQ(records.Capacity(), 0);
+  EXPECT_EQ(records.Field<0>().Size(), 0);
+}
+
+TEST(SoaArrayTest, CopyConstructor) {
+  const Records records{{1, 1.5, "a"}, {2, 2.5, "b"}};
+  const Records copy{records};
+  EXPECT_EQ(copy, records);
+}
+
+TEST(SoaArrayTest, MoveConstructor) {
+  Records records{{1, 1.5, "a"}};
+  const Records moved_records{std::move(records)};
+  EXPECT_EQ(moved_records, (Records{{1, 1.5, "a"}}));
+  EXPECT_TRUE(records.Empty());
+}
+
+TEST(SoaArrayTest, InitializerListConstructor) {
+  const Records records{{1, 1.5, "a"}, {2, 2.5, "b"}};
+  EXPECT_EQ(records.Size(), 2);
+  EXPECT_EQ(std::get<2>(records[1]), "b");
+}
+
+// Assignments
+
+TEST(SoaArrayTest, CopyAssignment) {
+  const Records records{{1, 1.5, "a"}};
+  Records copy{{3, 3.5, "c"}, {4, 4.5, "d"}};
+
+  copy = records;
+  EXPECT_EQ(copy, records);
+}
+
+TEST(SoaArrayTest, MoveAssignment) {
+  Records records{{1, 1.5, "a"}};
+  Records moved_records{{3, 3.5, "c"}};
+
+  moved_records = std::move(records);
+  EXPECT_EQ(moved_records, (Records{{1, 1.5, "a"}}));
+  EXPECT_TRUE(records.Empty());
+}
+
+// Element access
+
+TEST(SoaArrayTest, At) {
+  Records records{{1, 1.5, "a"}};
+  EXPECT_EQ(std::get<0>(records.At(0)), 1);
+  EXPECT_THROW(records.At(1), std::out_of_range);
+}
+
+TEST(SoaArrayTest, SubscriptOperator) {
+  Records records{{1, 1.5, "a"}, {2, 2.5, "b"}};
+
+  auto [id, score, name] = records[1];
+  id = 5;
+  name += "c";
+  EXPECT_EQ(records[1], (std::tuple<int, double, std::string>{5, 2.5, "bc"}));
+
+  records[0] = std::make_tuple(7, 7.5, "g");
+  EXPECT_EQ(std::get<0>(records.Front()), 7);
+  EXPECT_EQ(std::get<2>(records.Back()), "bc");
+}
+
+TEST(SoaArrayTest, Field) {
+  SoaArray<std::int64_t, float> records;
+  for (int i{0}; i < 1000; ++i) {
+    records.EmplaceBack(i, 0.5f);
+  }
+
+  const Span<std::int64_t> ids{records.Field<0>()};
+  ASSERT_EQ(ids.Size(), 1000);
+  std::int64_t sum{0};
+  for (const std::int64_t id : ids) {
+    sum += id;
+  }
+  EXPECT_EQ(sum, 999 * 1000 / 2);
+
+  for (float& weight : records.Field<1>()) {
+    weight *= 2;
+  }
+  EXPECT_EQ(std::get<1>(records[10]), 1.0f);
+}
+
+// Iterators
+
+TEST(SoaArrayTest, Begin) {
+  Records records{{1, 1.5, "a"}, {2, 2.5, "b"}};
+
+  for (auto [id, score, name] : records) {
+    score = id * 10;
+  }
+  EXPECT_EQ(std::get<1>(records[1]), 20);
+
+  Records::const_iterator it{records.begin()};
+  EXPECT_EQ(std::get<2>(*++it), "b");
+  EXPECT_EQ(records.end() - records.begin(), 2);
+}
+
+// Capacity
+
+TEST(SoaArrayTest, Reserve) {
+  Records records;
+
+  records.Reserve(10);
+  EXPECT_EQ(records.Capacity(), 10);
+
+  records.PushBack({1, 1.5, "a"});
+  records.ShrinkToFit();
+  EXPECT_EQ(records.Capacity(), 1);
+  EXPECT_EQ(records, (Records{{1, 1.5, "a"}}));
+}
+
+TEST(SoaArrayTest, Reserve_ThrowingCopy) {
+  SoaArray<std::string, ThrowingCopy> records;
+  records.EmplaceBack(std::string(64, 'a'), 1);
+  records.EmplaceBack(std::string(64, 'b'), 2);
+
+  ThrowingCopy::throw_on_copy = true;
+  EXPECT_THROW(records.Reserve(10), std::runtime_error);
+  ThrowingCopy::throw_on_copy = false;
+
+  EXPECT_EQ(records.Size(), 2);
+  EXPECT_EQ(records.Capacity(), 2);
+  EXPECT_EQ(records.Field<0>()[0], std::string(64, 'a'));
+  EXPECT_EQ(records.Field<0>()[1], std::string(64, 'b'));
+  EXPECT_EQ(records.Field<1>()[1].value, 2);
+}
+
+// Modifiers
+
+TEST(SoaArrayTest, PushBack) {
+  Records records;
+  for (int i{0}; i < 100; ++i) {
+    records.PushBack({i, i / 2.0, std::to_string(i)});
+  }
+
+  EXPECT_EQ(records.Size(), 100);
+  for (int i{0}; i < 100; ++i) {
+    EXPECT_EQ(records.Field<0>()[i], i);
+    EXPECT_EQ(records.Field<1>()[i], i / 2.0);
+    EXPECT_EQ(records.Field<2>()[i], std::to_string(i));
+  }
+}
+
+TEST(SoaArrayTest, EmplaceBack_MoveOnly) {
+  SoaArray<std::unique_ptr<int>, int> records;
+  for (int i{0}; i < 20; ++i) {
+    records.EmplaceBack(std::make_unique<int>(i), i);
+  }
+
+  EXPECT_EQ(*std::get<0>(records[19]), 19);
+}
+
+TEST(SoaArrayTest, EmplaceBack_SelfReference) {
+  Records records{{1, 1.5, std::string(64, 'a')}};
+  ASSERT_EQ(records.Size(), records.Capacity());
+
+  records.EmplaceBack(std::get<0>(records[0]), std::get<1>(records[0]),
+                      std::get<2>(records[0]));
+  EXPECT_EQ(records[1], records[0]);
+  EXPECT_EQ(std::get<2>(records[1]), std::string(64, 'a'));
+}
+
+TEST(SoaArrayTest, PopBack) {
+  Records records{{1, 1.5, "a"}, {2, 2.5, "b"}};
+
+  records.PopBack();
+  EXPECT_EQ(records, (Records{{1, 1.5, "a"}}));
+}
+
+TEST(SoaArrayTest, Resize) {
+  Records records{{1, 1.5, "a"}};
+
+  records.Resize(3);
+  EXPECT_EQ(records[2], (std::tuple<int, double, std::string>{}));
+
+  records.Resize(1);
+  EXPECT_EQ(records, (Records{{1, 1.5, "a"}}));
+}
+
+TEST(SoaArrayTest, Swap) {
+  Records records{{1, 1.5, "a"}};
+  Records other;
+
+  records.Swap(other);
+  EXPECT_TRUE(records.Empty());
+  EXPECT_EQ(other.Size(), 1);
+}
+
+// Comparison operators
+
+TEST(SoaArrayTest, EqualOperator) {
+  const Records records{{1, 1.5, "a"}, {2, 2.5, "b"}};
+  EXPECT_EQ(records, (Records{{1, 1.5, "a"}, {2, 2.5, "b"}}));
+  EXPECT_NE(records, (Records{{1, 1.5, "a"}, {2, 2.5, "c"}}));
+  EXPECT_NE(records, (Records{{1, 1.5, "a"}}));
+}
+
+// Debug
+
+TEST(SoaArrayTest, OutputOperator) {
+  std::ostringstream os;
+  os << Records{{1, 1.5, "a"}, {2, 2.5, "b"}};
+  EXPECT_EQ(os.str(), "[(1, 1.5, a), (2, 2.5, b)] (2)\n");
+}
@@ -2,13 +2,19 @@
 #define CPP_ALGORITHMS_DATA_STRUCTURES_STACK_STACK_H
 
 #include <initializer_list>
+#include <memory>
 #include <ostream>
 #include <utility>
 
 #include "dynamic_array.h"
+#include "growth_policy.h"
 
-template <class T>
+template <class T, class Allocator = std::allocator<T>,
+          class GrowthPolicy = DoublingGrowth>
 class Stack {
+ private:
+  using Container = DynamicArray<T, Allocator, GrowthPolicy>;
+
  public:
   using value_type = T;
   using size_type = std::size_t;
@@ -17,11 +23,10 @@ class Stack {
   using const_reference = const value_type&;
   using pointer = value_type*;
   using const_pointer = const value_type*;
-  using iterator = typename DynamicArray<T>::iterator;
-  using const_iterator = typename DynamicArray<T>::const_iterator;
-  using reverse_iterator = typename DynamicArray<T>::reverse_iterator;
-  using const_reverse_iterator =
-      typename DynamicArray<T>::const_reverse_iterator;
+  using iterator = typename Container::iterator;
+  using const_iterator = typename Container::const_iterator;
+  using reverse_iterator = typename Container::reverse_iterator;
+  using const_reverse_iterator = typename Container::const_reverse_iterator;
 
   // Constructors
 
@@ -85,6 +90,13 @@ class Stack {
 
   void Push(const_reference value) { container_.PushBack(value); }
 
+  void Push(T&& value) { container_.PushBack(std::move(value)); }
+
+  template <class... Args>
+  reference Emplace(Args&&... args) {
+    return container_.EmplaceBack(std::forward<Args>(args)...);
+  }
+
   void Pop() { container_.PopBack(); }
 
   void Swap(Stack& other) noexcept { container_.Swap(other.container_); }
@@ -124,7 +136,7 @@ class Stack {
   }
 
  private:
-  DynamicArray<T> container_;
+  Container container_;
 };
 
 #endif  // CPP_ALGORITHMS_DATA_STRUCTURES_STACK_STACK_H
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <string>
 #include <utility>
 
 // Constructors
@@ -258,6 +260,25 @@ TEST(StackTest, Push) {
   EXPECT_EQ(stack.Top(), 1);
 }
 
+TEST(StackTest, Emplace) {
+  Stack<std::pair<int, std::string>> stack;
+
+  stack.Push({1, "one"});
+  auto& top{stack.Emplace(2, "two")};
+  EXPECT_EQ(top.second, "two");
+  EXPECT_EQ(stack.Size(), 2);
+}
+
+TEST(StackTest, Push_GrowthPolicy) {
+  Stack<int, std::allocator<int>, FixedChunkGrowth<4>> stack;
+
+  for (int i{0}; i < 10; ++i) {
+    stack.Push(i);
+  }
+  EXPECT_EQ(stack.Size(), 10);
+  EXPECT_EQ(stack.Top(), 9);
+}
+
 TEST(StackTest, Pop) {
   Stack<int> stack{1, 2, 3};
 
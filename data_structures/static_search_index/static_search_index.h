@@ -0,0 +1,259 @@
+#ifndef CPP_ALGORITHMS_DATA_STRUCTURES_STATIC_SEARCH_INDEX_STATIC_SEARCH_INDEX_H_
+#define CPP_ALGORITHMS_DATA_STRUCTURES_STATIC_SEARCH_INDEX_STATIC_SEARCH_INDEX_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+
+#include "dynamic_array.h"
+#include "simd.h"
+#include "span.h"
+
+enum class SearchLayout {
+  // Binary tree in breadth-first order: the children of node k are 2k and
+  // 2k + 1, so the next four levels of a search share a few cache lines
+  // that can be prefetched ahead of time.
+  kEytzinger,
+  // Static B+1-ary tree of cache line sized nodes (an S-tree): every step
+  // loads one node and ranks the key within it with SIMD comparisons.
+  kSTree,
+};
+
+// Read-only index over sorted keys that answers LowerBound and UpperBound
+// queries with the rank of the result in the sorted order, touching far
+// fewer cache lines than a binary search over the sorted array.
+template <class T, SearchLayout Layout = SearchLayout::kEytzinger>
+class StaticSearchIndex {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  static constexpr size_type kCacheLineSize{64};
+  static constexpr size_type kNodeSize{
+      std::max<size_type>(kCacheLineSize / sizeof(T), 2)};
+  // Queries a batch search advances in lockstep to overlap their misses.
+  static constexpr size_type kBatchSize{16};
+
+  // Constructors
+
+  StaticSearchIndex() noexcept = default;
+
+  explicit StaticSearchIndex(const DynamicArray<T>& sorted)
+      : size_{sorted.Size()} {
+    if (!std::is_sorted(sorted.begin(), sorted.end())) {
+      throw std::invalid_argument("keys must be sorted");
+    }
+    if (size_ == 0) return;
+
+    std::size_t rank{0};
+    if constexpr (Layout == SearchLayout::kEytzinger) {
+      keys_.Resize(size_ + 1, sorted[0]);
+      ranks_.Resize(size_ + 1);
+      BuildEytzinger(sorted, rank, 1);
+    } else {
+      node_count_ = (size_ + kNodeSize - 1) / kNodeSize;
+      keys_.Resize(node_count_ * kNodeSize, sorted[size_ - 1]);
+      ranks_.Resize(node_count_ * kNodeSize, size_);
+      BuildSTree(sorted, rank, 0);
+    }
+  }
+
+  // Capacity
+
+  bool Empty() const noexcept { return size_ == 0; }
+
+  size_type Size() const noexcept { return size_; }
+
+  // Lookup
+
+  // Rank of the first key not less than `key`, or Size() if there is none.
+  size_type LowerBound(const T& key) const {
+    return RankOf(Search<false>(key));
+  }
+
+  // Rank of the first key greater than `key`, or Size() if there is none.
+  size_type UpperBound(const T& key) const {
+    return RankOf(Search<true>(key));
+  }
+
+  bool Contains(const T& key) const {
+    const std::size_t slot{Search<false>(key)};
+    return slot != kNotFound && !(key < keys_[slot]);
+  }
+
+  DynamicArray<size_type> LowerBoundBatch(const Span<const T> keys) const {
+    return SearchBatch<false>(keys);
+  }
+
+  DynamicArray<size_type> UpperBoundBatch(const Span<const T> keys) const {
+    return SearchBatch<true>(keys);
+  }
+
+  // Debug
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const StaticSearchIndex& index) noexcept {
+    os << "[";
+    const std::size_t first{Layout == SearchLayout::kEytzinger ? 1u : 0u};
+    for (std::size_t i{first}; i < index.keys_.Size(); ++i) {
+      if (i != first) os << ", ";
+      os << index.keys_[i];
+    }
+    os << "] (" << index.size_ << ")\n";
+    return os;
+  }
+
+ private:
+  static constexpr std::size_t kNotFound{SIZE_MAX};
+
+  // Eytzinger slots hold the keys in the order of an in-order traversal.
+  void BuildEytzinger(const DynamicArray<T>& sorted, std::size_t& rank,
+                      const std::size_t node) {
+    if (node > size_) return;
+
+    BuildEytzinger(sorted, rank, 2 * node);
+    keys_[node] = sorted[rank];
+    ranks_[node] = rank++;
+    BuildEytzinger(sorted, rank, 2 * node + 1);
+  }
+
+  // S-tree nodes past the last key are padded with copies of the largest
+  // key, which sort after it and therefore never become a result.
+  void BuildSTree(const DynamicArray<T>& sorted, std::size_t& rank,
+                  const std::size_t node) {
+    if (node >= node_count_) return;
+
+    for (std::size_t i{0}; i < kNodeSize; ++i) {
+      BuildSTree(sorted, rank, Child(node, i));
+      if (rank < size_) {
+        keys_[node * kNodeSize + i] = sorted[rank];
+        ranks_[node * kNodeSize + i] = rank++;
+      }
+    }
+    BuildSTree(sorted, rank, Child(node, kNodeSize));
+  }
+
+  static std::size_t Child(const std::size_t node, const std::size_t i) {
+    return node * (kNodeSize + 1) + i + 1;
+  }
+
+  size_type RankOf(const std::size_t slot) const {
+    return slot == kNotFound ? size_ : ranks_[slot];
+  }
+
+  // Whether the search for `key` continues right of `node_key`.
+  template <bool Upper>
+  static bool GoesRight(const T& node_key, const T& key) {
+    return Upper ? !(key < node_key) : node_key < key;
+  }
+
+  // Number of keys in the S-tree node the search for `key` skips over.
+  template <bool Upper>
+  std::size_t RankInNode(const std::size_t node, const T& key) const {
+    const T* const node_keys{keys_.Data() + node * kNodeSize};
+    return Upper ? kNodeSize - SimdCountGreater(node_keys, kNodeSize, key)
+                 : SimdCountLess(node_keys, kNodeSize, key);
+  }
+
+  // Slot of the lower (or upper) bound of `key`, or kNotFound.
+  template <bool Upper>
+  std::size_t Search(const T& key) const {
+    if constexpr (Layout == SearchLayout::kEytzinger) {
+      std::size_t node{1};
+      while (node <= size_) {
+        PrefetchDescendants(node);
+        node = 2 * node + GoesRight<Upper>(keys_[node], key);
+      }
+      return EytzingerResult(node);
+    } else {
+      std::size_t result{kNotFound};
+      for (std::size_t node{0}; node < node_count_;) {
+        const std::size_t i{RankInNode<Upper>(node, key)};
+        if (i < kNodeSize) result = node * kNodeSize + i;
+        node = Child(node, i);
+      }
+      return result;
+    }
+  }
+
+  // Advances kBatchSize searches at a time, one level per round, so that the
+  // cache misses of independent queries overlap.
+  template <bool Upper>
+  DynamicArray<size_type> SearchBatch(const Span<const T> keys) const {
+    DynamicArray<size_type> ranks;
+    ranks.Reserve(keys.Size());
+
+    for (std::size_t first{0}; first < keys.Size(); first += kBatchSize) {
+      const std::size_t count{std::min(kBatchSize, keys.Size() - first)};
+      const T* const batch{keys.Data() + first};
+      std::size_t nodes[kBatchSize];
+      std::size_t results[kBatchSize];
+
+      if constexpr (Layout == SearchLayout::kEytzinger) {
+        std::fill_n(nodes, count, 1);
+        for (bool active{true}; active;) {
+          active = false;
+          for (std::size_t i{0}; i < count; ++i) {
+            if (nodes[i] > size_) continue;
+            PrefetchDescendants(nodes[i]);
+            nodes[i] =
+                2 * nodes[i] + GoesRight<Upper>(keys_[nodes[i]], batch[i]);
+            active = true;
+          }
+        }
+        for (std::size_t i{0}; i < count; ++i) {
+          results[i] = EytzingerResult(nodes[i]);
+        }
+      } else {
+        std::fill_n(nodes, count, 0);
+        std::fill_n(results, count, kNotFound);
+        for (bool active{true}; active;) {
+          active = false;
+          for (std::size_t i{0}; i < count; ++i) {
+            if (nodes[i] >= node_count_) continue;
+            const std::size_t rank{RankInNode<Upper>(nodes[i], batch[i])};
+            if (rank < kNodeSize) results[i] = nodes[i] * kNodeSize + rank;
+            nodes[i] = Child(nodes[i], rank);
+            if (nodes[i] < node_count_) {
+              Prefetch(keys_.Data() + nodes[i] * kNodeSize);
+              active = true;
+            }
+          }
+        }
+      }
+
+      for (std::size_t i{0}; i < count; ++i) {
+        ranks.PushBack(RankOf(results[i]));
+      }
+    }
+    return ranks;
+  }
+
+  // The descendants four levels below `node` are 16 * node to 16 * node + 15.
+  // Addresses past the end are fine for a prefetch, so no bounds check.
+  void PrefetchDescendants(const std::size_t node) const {
+    constexpr std::size_t kStride{
+        std::max<std::size_t>(kCacheLineSize / sizeof(T), 1)};
+    Prefetch(reinterpret_cast<const void*>(
+        reinterpret_cast<std::uintptr_t>(keys_.Data()) +
+        node * kStride * sizeof(T)));
+  }
+
+  // A search ends past a leaf after going right some times since it last
+  // went left. Undoing those right turns and the final left turn gives the
+  // node where it went left, i.e. the bound.
+  static std::size_t EytzingerResult(std::size_t node) {
+    while (node & 1) node >>= 1;
+    node >>= 1;
+    return node == 0 ? kNotFound : node;
+  }
+
+  DynamicArray<T> keys_;
+  DynamicArray<size_type> ranks_;
+  std::size_t size_{0};
+  std::size_t node_count_{0};
+};
+
+#endif  // CPP_ALGORITHMS_DATA_STRUCTURES_STATIC_SEARCH_INDEX_STATIC_SEARCH_INDEX_H_
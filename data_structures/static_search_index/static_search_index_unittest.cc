@@ -0,0 +1,129 @@
+#include "static_search_index.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "dynamic_array.h"
+#include "span.h"
+
+template <class T>
+DynamicArray<T> SortedKeys(const std::size_t size, const int max) {
+  std::mt19937 generator{static_cast<std::mt19937::result_type>(size)};
+  std::uniform_int_distribution<int> distribution{0, max};
+
+  DynamicArray<T> keys;
+  for (std::size_t i{0}; i < size; ++i) {
+    keys.PushBack(static_cast<T>(distribution(generator)));
+  }
+  std::sort(keys.begin(), keys.end());
+  return keys;
+}
+
+// Checks every query in [-1, max + 1] against std::lower_bound and
+// std::upper_bound, one at a time and in a batch.
+template <class T, SearchLayout Layout>
+void ExpectMatchesBinarySearch(const int max) {
+  for (const std::size_t size : {0, 1, 2, 15, 16, 17, 100, 1000, 4097}) {
+    const DynamicArray<T> sorted{SortedKeys<T>(size, max)};
+    const StaticSearchIndex<T, Layout> index{sorted};
+
+    DynamicArray<T> queries;
+    for (int query{-1}; query <= max + 1; ++query) {
+      queries.PushBack(static_cast<T>(query));
+    }
+    const DynamicArray<std::size_t> lower_bounds{index.LowerBoundBatch(
+        Span<const T>{queries.Data(), queries.Size()})};
+    const DynamicArray<std::size_t> upper_bounds{index.UpperBoundBatch(
+        Span<const T>{queries.Data(), queries.Size()})};
+    ASSERT_EQ(lower_bounds.Size(), queries.Size());
+    ASSERT_EQ(upper_bounds.Size(), queries.Size());
+
+    for (std::size_t i{0}; i < queries.Size(); ++i) {
+      const T& query{queries[i]};
+      const auto lower{static_cast<std::size_t>(
+          std::lower_bound(sorted.begin(), sorted.end(), query) -
+          sorted.begin())};
+      const auto upper{static_cast<std::size_t>(
+          std::upper_bound(sorted.begin(), sorted.end(), query) -
+          sorted.begin())};
+
+      ASSERT_EQ(index.LowerBound(query), lower) << size << ", " << query;
+      ASSERT_EQ(index.UpperBound(query), upper) << size << ", " << query;
+      ASSERT_EQ(lower_bounds[i], lower) << size << ", " << query;
+      ASSERT_EQ(upper_bounds[i], upper) << size << ", " << query;
+      ASSERT_EQ(index.Contains(query), lower != upper);
+    }
+  }
+}
+
+// Constructors
+
+TEST(StaticSearchIndexTest, Constructor) {
+  const StaticSearchIndex<int> index;
+  EXPECT_TRUE(index.Empty());
+  EXPECT_EQ(index.LowerBound(1), 0);
+  EXPECT_FALSE(index.Contains(1));
+}
+
+TEST(StaticSearchIndexTest, Constructor_Unsorted) {
+  EXPECT_THROW((StaticSearchIndex<int>{DynamicArray<int>{1, 3, 2}}),
+               std::invalid_argument);
+  EXPECT_THROW((StaticSearchIndex<int, SearchLayout::kSTree>{
+                   DynamicArray<int>{2, 1}}),
+               std::invalid_argument);
+}
+
+// Lookup
+
+TEST(StaticSearchIndexTest, Eytzinger) {
+  ExpectMatchesBinarySearch<int, SearchLayout::kEytzinger>(500);
+  ExpectMatchesBinarySearch<std::int64_t, SearchLayout::kEytzinger>(10);
+  ExpectMatchesBinarySearch<double, SearchLayout::kEytzinger>(500);
+}
+
+TEST(StaticSearchIndexTest, STree) {
+  ExpectMatchesBinarySearch<int, SearchLayout::kSTree>(500);
+  ExpectMatchesBinarySearch<std::uint8_t, SearchLayout::kSTree>(200);
+  ExpectMatchesBinarySearch<std::uint32_t, SearchLayout::kSTree>(10);
+  ExpectMatchesBinarySearch<std::int64_t, SearchLayout::kSTree>(500);
+  ExpectMatchesBinarySearch<float, SearchLayout::kSTree>(500);
+}
+
+TEST(StaticSearchIndexTest, STree_NonArithmetic) {
+  const DynamicArray<std::string> sorted{"apple", "banana", "cherry", "date",
+                                         "elderberry"};
+  const StaticSearchIndex<std::string, SearchLayout::kSTree> index{sorted};
+
+  EXPECT_EQ(index.LowerBound("banana"), 1);
+  EXPECT_EQ(index.UpperBound("banana"), 2);
+  EXPECT_EQ(index.LowerBound("coconut"), 3);
+  EXPECT_EQ(index.LowerBound("fig"), 5);
+  EXPECT_TRUE(index.Contains("date"));
+  EXPECT_FALSE(index.Contains("apricot"));
+}
+
+TEST(StaticSearchIndexTest, UnsignedRanges) {
+  // Range starts of an IP table, looked up by the last start <= address.
+  const DynamicArray<std::uint32_t> starts{0x0A000000, 0x7F000000,
+                                           0xC0A80000, 0xFFFFFF00};
+  const StaticSearchIndex<std::uint32_t, SearchLayout::kSTree> index{starts};
+
+  EXPECT_EQ(index.UpperBound(0xC0A80001) - 1, 2);
+  EXPECT_EQ(index.UpperBound(0xFFFFFFFF) - 1, 3);
+  EXPECT_EQ(index.UpperBound(0x09FFFFFF), 0);
+}
+
+// Debug
+
+TEST(StaticSearchIndexTest, OutputOperator) {
+  std::ostringstream os;
+  os << StaticSearchIndex<int>{DynamicArray<int>{1, 2, 3, 4, 5, 6, 7}};
+  EXPECT_EQ(os.str(), "[4, 2, 6, 1, 3, 5, 7] (7)\n");
+}
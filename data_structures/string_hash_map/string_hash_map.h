@@ -0,0 +1,556 @@
+#ifndef CPP_ALGORITHMS_DATA_STRUCTURES_STRING_HASH_MAP_STRING_HASH_MAP_H_
+#define CPP_ALGORITHMS_DATA_STRUCTURES_STRING_HASH_MAP_STRING_HASH_MAP_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include "dynamic_array.h"
+#include "is_iterator.h"
+
+// Open-addressing map specialized for string keys. Keys of up to
+// kInlineCapacity bytes are stored inside the slot, longer keys are copied
+// into an append-only arena owned by the map. Probing compares the cached
+// 32-bit hash and the key length before touching the key bytes.
+template <class T, class Hash = std::hash<std::string_view>>
+class StringHashMap {
+ private:
+  static constexpr std::size_t kInlineCapacity{16};
+  static constexpr std::size_t kArenaBlockSize{64 * 1024};
+  static constexpr std::size_t kMinBucketCount{8};
+
+  enum class State : std::uint8_t { kEmpty, kOccupied, kErased };
+
+  struct Slot {
+    std::uint32_t hash{0};
+    std::uint32_t size{0};
+    union {
+      char inline_key[kInlineCapacity];
+      const char* external_key;
+    };
+    State state{State::kEmpty};
+    T value{};
+
+    std::string_view Key() const noexcept {
+      return {size <= kInlineCapacity ? inline_key : external_key, size};
+    }
+  };
+
+  template <class Reference>
+  class ArrowProxy {
+   public:
+    ArrowProxy(Reference reference) : reference_{reference} {}
+
+    Reference* operator->() noexcept { return &reference_; }
+
+   private:
+    Reference reference_;
+  };
+
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::pair<std::string_view, T>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<std::string_view, T&>;
+    using pointer = ArrowProxy<reference>;
+
+    Iterator(Slot* const slot, Slot* const last) noexcept
+        : slot_{slot}, last_{last} {
+      SkipFree();
+    }
+
+    reference operator*() const noexcept {
+      return {slot_->Key(), slot_->value};
+    }
+
+    pointer operator->() const noexcept { return pointer(**this); }
+
+    Iterator& operator++() noexcept {
+      ++slot_;
+      SkipFree();
+      return *this;
+    }
+
+    Iterator operator++(int) noexcept {
+      Iterator temp{*this};
+      ++(*this);
+      return temp;
+    }
+
+    bool operator==(const Iterator& other) const noexcept {
+      return slot_ == other.slot_;
+    }
+
+    bool operator!=(const Iterator& other) const noexcept {
+      return !(*this == other);
+    }
+
+   private:
+    void SkipFree() noexcept {
+      while (slot_ != last_ && slot_->state != State::kOccupied) ++slot_;
+    }
+
+    Slot* slot_;
+    Slot* last_;
+
+    friend class StringHashMap;
+  };
+
+  class ConstIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::pair<std::string_view, T>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<std::string_view, const T&>;
+    using pointer = ArrowProxy<reference>;
+
+    ConstIterator(const Slot* const slot, const Slot* const last) noexcept
+        : slot_{slot}, last_{last} {
+      SkipFree();
+    }
+
+    ConstIterator(const Iterator iterator) noexcept
+        : slot_{iterator.slot_}, last_{iterator.last_} {}
+
+    reference operator*() const noexcept {
+      return {slot_->Key(), slot_->value};
+    }
+
+    pointer operator->() const noexcept { return pointer(**this); }
+
+    ConstIterator& operator++() noexcept {
+      ++slot_;
+      SkipFree();
+      return *this;
+    }
+
+    ConstIterator operator++(int) noexcept {
+      ConstIterator temp{*this};
+      ++(*this);
+      return temp;
+    }
+
+    bool operator==(const ConstIterator& other) const noexcept {
+      return slot_ == other.slot_;
+    }
+
+    bool operator!=(const ConstIterator& other) const noexcept {
+      return !(*this == other);
+    }
+
+   private:
+    void SkipFree() noexcept {
+      while (slot_ != last_ && slot_->state != State::kOccupied) ++slot_;
+    }
+
+    const Slot* slot_;
+    const Slot* last_;
+
+    friend class StringHashMap;
+  };
+
+ public:
+  using key_type = std::string_view;
+  using mapped_type = T;
+  using value_type = std::pair<std::string_view, T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using reference = std::pair<std::string_view, T&>;
+  using const_reference = std::pair<std::string_view, const T&>;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  // Constructors
+
+  StringHashMap() noexcept = default;
+
+  StringHashMap(const StringHashMap& other) {
+    max_load_factor_ = other.max_load_factor_;
+    Reserve(other.Size());
+
+    for (const auto& [key, value] : other) {
+      InsertUnchecked(key, value);
+    }
+  }
+
+  StringHashMap(StringHashMap&& other) noexcept { Swap(other); }
+
+  StringHashMap(const std::initializer_list<value_type> list) { Insert(list); }
+
+  ~StringHashMap() { ReleaseArena(); }
+
+  // Assignments
+
+  StringHashMap& operator=(const StringHashMap& other) {
+    if (this == &other) return *this;
+
+    Clear();
+    max_load_factor_ = other.max_load_factor_;
+    CheckRehash(other.Size());
+
+    for (const auto& [key, value] : other) {
+      InsertUnchecked(key, value);
+    }
+
+    return *this;
+  }
+
+  StringHashMap& operator=(StringHashMap&& other) noexcept {
+    if (this == &other) return *this;
+
+    Clear();
+    Swap(other);
+
+    return *this;
+  }
+
+  StringHashMap& operator=(const std::initializer_list<value_type> list) {
+    Clear();
+    Insert(list);
+    return *this;
+  }
+
+  // Iterators
+
+  iterator begin() noexcept { return iterator(SlotsBegin(), SlotsEnd()); }
+  const_iterator begin() const noexcept {
+    return const_iterator(SlotsBegin(), SlotsEnd());
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  iterator end() noexcept { return iterator(SlotsEnd(), SlotsEnd()); }
+  const_iterator end() const noexcept {
+    return const_iterator(SlotsEnd(), SlotsEnd());
+  }
+  const_iterator cend() const noexcept { return end(); }
+
+  // Capacity
+
+  bool Empty() const noexcept { return size_ == 0; }
+
+  size_type Size() const noexcept { return size_; }
+
+  size_type ArenaSize() const noexcept { return arena_size_; }
+
+  // Modifiers
+
+  void Clear() noexcept {
+    for (Slot& slot : slots_) {
+      slot = Slot{};
+    }
+    size_ = 0;
+    erased_ = 0;
+    ReleaseArena();
+  }
+
+  std::pair<iterator, bool> Insert(const value_type& value) {
+    const std::uint32_t hash{HashKey(value.first)};
+    if (Slot* const existing{FindSlot(value.first, hash)};
+        existing != nullptr) {
+      return {iterator(existing, SlotsEnd()), false};
+    }
+
+    CheckRehash(1);
+    return {iterator(InsertUnchecked(value.first, value.second, hash),
+                     SlotsEnd()),
+            true};
+  }
+
+  template <class InputIterator,
+            std::enable_if_t<is_iterator<InputIterator>, bool> = false>
+  void Insert(const InputIterator first, const InputIterator last) {
+    if (first == last) return;
+
+    const std::size_t distance{
+        static_cast<std::size_t>(std::distance(first, last))};
+    CheckRehash(distance);
+
+    for (InputIterator it{first}; it != last; ++it) {
+      const std::uint32_t hash{HashKey(it->first)};
+      if (FindSlot(it->first, hash) != nullptr) continue;
+      InsertUnchecked(it->first, it->second, hash);
+    }
+  }
+
+  void Insert(const std::initializer_list<value_type> list) {
+    Insert(list.begin(), list.end());
+  }
+
+  std::pair<iterator, bool> InsertOrAssign(const std::string_view key,
+                                           const T& value) {
+    const std::uint32_t hash{HashKey(key)};
+    if (Slot* const existing{FindSlot(key, hash)}; existing != nullptr) {
+      existing->value = value;
+      return {iterator(existing, SlotsEnd()), false};
+    }
+
+    CheckRehash(1);
+    return {iterator(InsertUnchecked(key, value, hash), SlotsEnd()), true};
+  }
+
+  iterator Erase(const const_iterator position) {
+    Slot* const slot{const_cast<Slot*>(position.slot_)};
+    slot->state = State::kErased;
+    slot->value = T();
+    --size_;
+    ++erased_;
+    return iterator(slot, SlotsEnd());
+  }
+
+  size_type Erase(const std::string_view key) {
+    Slot* const slot{FindSlot(key, HashKey(key))};
+    if (slot == nullptr) return 0;
+
+    Erase(const_iterator(slot, SlotsEnd()));
+    return 1;
+  }
+
+  void Swap(StringHashMap& other) noexcept {
+    slots_.Swap(other.slots_);
+    arena_blocks_.Swap(other.arena_blocks_);
+    std::swap(arena_block_, other.arena_block_);
+    std::swap(arena_remaining_, other.arena_remaining_);
+    std::swap(arena_size_, other.arena_size_);
+    std::swap(size_, other.size_);
+    std::swap(erased_, other.erased_);
+    std::swap(max_load_factor_, other.max_load_factor_);
+  }
+
+  // Lookup
+
+  T& At(const std::string_view key) {
+    return const_cast<T&>(std::as_const(*this).At(key));
+  }
+  const T& At(const std::string_view key) const {
+    const Slot* const slot{FindSlot(key, HashKey(key))};
+    if (slot == nullptr) throw std::out_of_range("key out of bounds");
+    return slot->value;
+  }
+
+  T& operator[](const std::string_view key) {
+    return (*Insert({key, T()}).first).second;
+  }
+
+  size_type Count(const std::string_view key) const {
+    return Contains(key) ? 1 : 0;
+  }
+
+  iterator Find(const std::string_view key) {
+    Slot* const slot{FindSlot(key, HashKey(key))};
+    return slot == nullptr ? end() : iterator(slot, SlotsEnd());
+  }
+  const_iterator Find(const std::string_view key) const {
+    const Slot* const slot{FindSlot(key, HashKey(key))};
+    return slot == nullptr ? end() : const_iterator(slot, SlotsEnd());
+  }
+
+  bool Contains(const std::string_view key) const {
+    return FindSlot(key, HashKey(key)) != nullptr;
+  }
+
+  // Bucket interface
+
+  size_type BucketCount() const { return slots_.Size(); }
+
+  size_type Bucket(const std::string_view key) const {
+    return HashKey(key) & (BucketCount() - 1);
+  }
+
+  // Hash policy
+
+  float LoadFactor() const {
+    return Empty() ? 0 : static_cast<float>(Size()) / BucketCount();
+  }
+
+  float MaxLoadFactor() const { return max_load_factor_; }
+  void MaxLoadFactor(const float max_load_factor) {
+    max_load_factor_ = std::min(max_load_factor, 0.95f);
+  }
+
+  void Rehash(const size_type count) {
+    const std::size_t min_count{
+        static_cast<std::size_t>(std::ceil(Size() / max_load_factor_))};
+    std::size_t new_size{kMinBucketCount};
+    while (new_size < std::max(min_count, count)) new_size *= 2;
+
+    DynamicArray<Slot> old_slots;
+    old_slots.Swap(slots_);
+    slots_.Resize(new_size);
+    size_ = 0;
+    erased_ = 0;
+
+    for (const Slot& slot : old_slots) {
+      if (slot.state != State::kOccupied) continue;
+      PlaceUnchecked(slot);
+    }
+  }
+
+  void Reserve(const size_type count) {
+    Rehash(std::ceil(count / max_load_factor_));
+  }
+
+  // Comparison operators
+
+  bool operator==(const StringHashMap& other) const noexcept {
+    if (Size() != other.Size()) return false;
+
+    for (const auto& [key, value] : *this) {
+      const Slot* const slot{other.FindSlot(key, other.HashKey(key))};
+      if (slot == nullptr || slot->value != value) return false;
+    }
+    return true;
+  }
+
+  bool operator!=(const StringHashMap& other) const noexcept {
+    return !(*this == other);
+  }
+
+  // Debug
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const StringHashMap& hash_map) noexcept {
+    os << "[";
+
+    bool first{true};
+    for (const auto& [key, value] : hash_map) {
+      if (!first) os << ", ";
+      os << key << " -> " << value << " (" << hash_map.Bucket(key) << ")";
+      first = false;
+    }
+
+    os << "] (" << hash_map.Size() << ", buckets: " << hash_map.BucketCount()
+       << ", arena: " << hash_map.ArenaSize() << ")\n";
+    return os;
+  }
+
+ private:
+  std::uint32_t HashKey(const std::string_view key) const {
+    const std::uint64_t hash{static_cast<std::uint64_t>(Hash{}(key))};
+    return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+  }
+
+  Slot* SlotsBegin() noexcept { return slots_.Data(); }
+  const Slot* SlotsBegin() const noexcept { return slots_.Data(); }
+
+  Slot* SlotsEnd() noexcept { return slots_.Data() + slots_.Size(); }
+  const Slot* SlotsEnd() const noexcept {
+    return slots_.Data() + slots_.Size();
+  }
+
+  Slot* FindSlot(const std::string_view key, const std::uint32_t hash) {
+    return const_cast<Slot*>(std::as_const(*this).FindSlot(key, hash));
+  }
+  const Slot* FindSlot(const std::string_view key,
+                       const std::uint32_t hash) const {
+    if (Empty()) return nullptr;
+
+    const std::size_t mask{BucketCount() - 1};
+    for (std::size_t i{hash & mask};; i = (i + 1) & mask) {
+      const Slot& slot{slots_[i]};
+      if (slot.state == State::kEmpty) return nullptr;
+      if (slot.state == State::kOccupied && slot.hash == hash &&
+          slot.size == key.size() &&
+          std::memcmp(slot.Key().data(), key.data(), key.size()) == 0) {
+        return &slot;
+      }
+    }
+  }
+
+  Slot* InsertUnchecked(const std::string_view key, const T& value) {
+    return InsertUnchecked(key, value, HashKey(key));
+  }
+
+  Slot* InsertUnchecked(const std::string_view key, const T& value,
+                        const std::uint32_t hash) {
+    Slot slot;
+    slot.hash = hash;
+    slot.size = static_cast<std::uint32_t>(key.size());
+    if (key.size() <= kInlineCapacity) {
+      std::memcpy(slot.inline_key, key.data(), key.size());
+    } else {
+      slot.external_key = Intern(key);
+    }
+    slot.state = State::kOccupied;
+    slot.value = value;
+
+    return PlaceUnchecked(slot);
+  }
+
+  Slot* PlaceUnchecked(const Slot& slot) {
+    const std::size_t mask{BucketCount() - 1};
+    std::size_t i{slot.hash & mask};
+    while (slots_[i].state == State::kOccupied) i = (i + 1) & mask;
+
+    if (slots_[i].state == State::kErased) --erased_;
+    slots_[i] = slot;
+    ++size_;
+    return &slots_[i];
+  }
+
+  void CheckRehash(const std::size_t additional) {
+    const std::size_t new_size{Size() + erased_ + additional};
+    if (new_size <= max_load_factor_ * BucketCount()) return;
+
+    const std::size_t required{static_cast<std::size_t>(
+        std::ceil((Size() + additional) / max_load_factor_))};
+    Rehash(required > BucketCount() ? std::max(required, BucketCount() * 2)
+                                    : BucketCount());
+  }
+
+  // Long keys get a block of their own, which never becomes the block that
+  // short keys are bumped into.
+  const char* Intern(const std::string_view key) {
+    if (key.size() > kArenaBlockSize / 4) {
+      char* const block{new char[key.size()]};
+      std::memcpy(block, key.data(), key.size());
+      arena_blocks_.PushBack(block);
+      arena_size_ += key.size();
+      return block;
+    }
+
+    if (arena_remaining_ < key.size()) {
+      arena_blocks_.PushBack(new char[kArenaBlockSize]);
+      arena_block_ = arena_blocks_.Back();
+      arena_remaining_ = kArenaBlockSize;
+      arena_size_ += kArenaBlockSize;
+    }
+
+    char* const interned{arena_block_};
+    std::memcpy(interned, key.data(), key.size());
+    arena_block_ += key.size();
+    arena_remaining_ -= key.size();
+    return interned;
+  }
+
+  void ReleaseArena() noexcept {
+    for (char* const block : arena_blocks_) {
+      delete[] block;
+    }
+    arena_blocks_.Clear();
+    arena_block_ = nullptr;
+    arena_remaining_ = 0;
+    arena_size_ = 0;
+  }
+
+  DynamicArray<Slot> slots_;
+  DynamicArray<char*> arena_blocks_;
+  char* arena_block_{nullptr};
+  std::size_t arena_remaining_{0};
+  std::size_t arena_size_{0};
+  std::size_t size_{0};
+  std::size_t erased_{0};
+  float max_load_factor_{0.75};
+};
+
+#endif  // CPP_ALGORITHMS_DATA_STRUCTURES_STRING_HASH_MAP_STRING_HASH_MAP_H_
@@ -0,0 +1,310 @@
+#include "string_hash_map.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+const std::string kLongKey(40, 'x');
+
+// Constructors
+
+TEST(StringHashMapTest, Constructor) {
+  const StringHashMap<int> hash_map;
+  EXPECT_EQ(hash_map.Size(), 0);
+  EXPECT_EQ(hash_map.BucketCount(), 0);
+  EXPECT_EQ(hash_map.begin(), hash_map.end());
+}
+
+TEST(StringHashMapTest, CopyConstructor) {
+  const StringHashMap<int> hash_map{{"one", 1}, {"two", 2}, {kLongKey, 3}};
+
+  const StringHashMap<int> copy{hash_map};
+  EXPECT_EQ(copy, hash_map);
+  EXPECT_EQ(copy.ArenaSize(), hash_map.ArenaSize());
+}
+
+TEST(StringHashMapTest, MoveConstructor) {
+  StringHashMap<int> hash_map{{"one", 1}, {"two", 2}, {kLongKey, 3}};
+
+  const StringHashMap<int> moved_hash_map{std::move(hash_map)};
+  EXPECT_EQ(moved_hash_map.Size(), 3);
+  EXPECT_EQ(moved_hash_map.At(kLongKey), 3);
+  EXPECT_EQ(hash_map.Size(), 0);
+  EXPECT_EQ(hash_map.ArenaSize(), 0);
+}
+
+TEST(StringHashMapTest, InitializerListConstructor) {
+  const StringHashMap<int> hash_map{{"one", 1}, {"two", 2}, {"one", 3}};
+  EXPECT_EQ(hash_map.Size(), 2);
+  EXPECT_EQ(hash_map.At("one"), 1);
+  EXPECT_EQ(hash_map.At("two"), 2);
+}
+
+// Assignments
+
+TEST(StringHashMapTest, CopyAssignment) {
+  const StringHashMap<int> hash_map{{"one", 1}, {"two", 2}, {kLongKey, 3}};
+  StringHashMap<int> copy{{"four", 4}};
+
+  copy = hash_map;
+  EXPECT_EQ(copy, hash_map);
+}
+
+TEST(StringHashMapTest, MoveAssignment) {
+  StringHashMap<int> hash_map{{"one", 1}, {"two", 2}, {kLongKey, 3}};
+  StringHashMap<int> moved_hash_map;
+
+  moved_hash_map = std::move(hash_map);
+  EXPECT_EQ(moved_hash_map.Size(), 3);
+  EXPECT_EQ(hash_map.Size(), 0);
+}
+
+// Iterators
+
+TEST(StringHashMapTest, Begin) {
+  StringHashMap<int> hash_map{{kLongKey, 1}};
+
+  auto it{hash_map.begin()};
+  EXPECT_EQ(it->first, kLongKey);
+  EXPECT_EQ((*it).second, 1);
+
+  it->second = 2;
+  EXPECT_EQ(hash_map.At(kLongKey), 2);
+}
+
+TEST(StringHashMapTest, RangeFor) {
+  const StringHashMap<int> hash_map{{"one", 1}, {"two", 2}, {kLongKey, 3}};
+
+  int sum{0};
+  std::size_t key_sizes{0};
+  for (const auto& [key, value] : hash_map) {
+    sum += value;
+    key_sizes += key.size();
+  }
+  EXPECT_EQ(sum, 6);
+  EXPECT_EQ(key_sizes, 6 + kLongKey.size());
+}
+
+// Capacity
+
+TEST(StringHashMapTest, Empty) {
+  const StringHashMap<int> empty_hash_map;
+  EXPECT_TRUE(empty_hash_map.Empty());
+
+  const StringHashMap<int> hash_map{{"one", 1}};
+  EXPECT_FALSE(hash_map.Empty());
+}
+
+TEST(StringHashMapTest, ArenaSize) {
+  StringHashMap<int> hash_map{{"short", 1}};
+  EXPECT_EQ(hash_map.ArenaSize(), 0);
+
+  hash_map.Insert({kLongKey, 2});
+  EXPECT_GT(hash_map.ArenaSize(), 0);
+
+  hash_map.Clear();
+  EXPECT_EQ(hash_map.ArenaSize(), 0);
+}
+
+// Modifiers
+
+TEST(StringHashMapTest, Clear) {
+  StringHashMap<int> hash_map{{"one", 1}, {kLongKey, 2}};
+
+  hash_map.Clear();
+  EXPECT_TRUE(hash_map.Empty());
+  EXPECT_FALSE(hash_map.Contains("one"));
+  EXPECT_FALSE(hash_map.Contains(kLongKey));
+}
+
+TEST(StringHashMapTest, Insert) {
+  StringHashMap<int> hash_map;
+
+  auto [it, inserted] = hash_map.Insert({"one", 1});
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(it->first, "one");
+  EXPECT_EQ(it->second, 1);
+
+  std::tie(it, inserted) = hash_map.Insert({"one", 2});
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(it->second, 1);
+
+  std::tie(it, inserted) = hash_map.Insert({kLongKey, 3});
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(it->first, kLongKey);
+  EXPECT_EQ(hash_map.Size(), 2);
+}
+
+TEST(StringHashMapTest, Insert_Many) {
+  StringHashMap<std::size_t> hash_map;
+
+  auto key = [](const std::size_t i) -> std::string {
+    return "key-" + std::to_string(i) + std::string(i % 32, '-');
+  };
+
+  for (std::size_t i{0}; i < 10000; ++i) {
+    hash_map.Insert({key(i), i});
+  }
+  EXPECT_EQ(hash_map.Size(), 10000);
+  EXPECT_LE(hash_map.LoadFactor(), hash_map.MaxLoadFactor());
+
+  for (std::size_t i{0}; i < 10000; ++i) {
+    EXPECT_EQ(hash_map.At(key(i)), i);
+  }
+}
+
+TEST(StringHashMapTest, Insert_LongKeys) {
+  StringHashMap<std::size_t> hash_map;
+
+  // Over 16 KiB, so the first key gets an arena block of its own, which
+  // shorter keys must not be copied into.
+  const std::string first_key(16 * 1024 + 1, 'a');
+  hash_map.Insert({first_key, 0});
+
+  auto key = [](const std::size_t i) -> std::string {
+    return std::to_string(i) + std::string(4000, 'b');
+  };
+  for (std::size_t i{1}; i <= 20; ++i) {
+    hash_map.Insert({key(i), i});
+  }
+
+  EXPECT_EQ(hash_map.At(first_key), 0);
+  for (std::size_t i{1}; i <= 20; ++i) {
+    EXPECT_EQ(hash_map.At(key(i)), i);
+  }
+  for (const auto& [stored_key, value] : hash_map) {
+    EXPECT_EQ(stored_key, value == 0 ? first_key : key(value));
+  }
+}
+
+TEST(StringHashMapTest, InsertOrAssign) {
+  StringHashMap<int> hash_map{{"one", 1}};
+
+  EXPECT_FALSE(hash_map.InsertOrAssign("one", 11).second);
+  EXPECT_EQ(hash_map.At("one"), 11);
+
+  EXPECT_TRUE(hash_map.InsertOrAssign(kLongKey, 2).second);
+  EXPECT_EQ(hash_map.At(kLongKey), 2);
+}
+
+TEST(StringHashMapTest, Erase_Iterator) {
+  StringHashMap<int> hash_map{{"one", 1}};
+
+  const auto next{hash_map.Erase(hash_map.Find("one"))};
+  EXPECT_EQ(next, hash_map.end());
+  EXPECT_TRUE(hash_map.Empty());
+}
+
+TEST(StringHashMapTest, Erase_Key) {
+  StringHashMap<int> hash_map{{"one", 1}, {"two", 2}, {kLongKey, 3}};
+
+  EXPECT_EQ(hash_map.Erase("one"), 1);
+  EXPECT_EQ(hash_map.Erase("one"), 0);
+  EXPECT_EQ(hash_map.Erase(kLongKey), 1);
+  EXPECT_EQ(hash_map.Size(), 1);
+  EXPECT_EQ(hash_map.At("two"), 2);
+
+  hash_map.Insert({"one", 4});
+  EXPECT_EQ(hash_map.At("one"), 4);
+}
+
+TEST(StringHashMapTest, Erase_Reinsert) {
+  StringHashMap<int> hash_map;
+
+  for (int round{0}; round < 100; ++round) {
+    for (int i{0}; i < 100; ++i) {
+      hash_map.Insert({std::to_string(i), round});
+    }
+    for (int i{0}; i < 100; ++i) {
+      EXPECT_EQ(hash_map.Erase(std::to_string(i)), 1);
+    }
+  }
+  EXPECT_TRUE(hash_map.Empty());
+  EXPECT_LE(hash_map.BucketCount(), 256);
+}
+
+TEST(StringHashMapTest, Swap) {
+  StringHashMap<int> a{{"one", 1}};
+  StringHashMap<int> b{{"two", 2}, {kLongKey, 3}};
+  const StringHashMap<int> expected_a{b};
+  const StringHashMap<int> expected_b{a};
+
+  a.Swap(b);
+  EXPECT_EQ(a, expected_a);
+  EXPECT_EQ(b, expected_b);
+}
+
+// Lookup
+
+TEST(StringHashMapTest, At) {
+  StringHashMap<int> hash_map{{"one", 1}};
+  EXPECT_EQ(hash_map.At("one"), 1);
+  EXPECT_THROW(hash_map.At("two"), std::out_of_range);
+
+  hash_map.At("one") = 2;
+  EXPECT_EQ(hash_map.At("one"), 2);
+}
+
+TEST(StringHashMapTest, SubscriptOperator) {
+  StringHashMap<int> hash_map;
+
+  hash_map[kLongKey] = 1;
+  ++hash_map[kLongKey];
+  EXPECT_EQ(hash_map.At(kLongKey), 2);
+  EXPECT_EQ(hash_map["missing"], 0);
+  EXPECT_EQ(hash_map.Size(), 2);
+}
+
+TEST(StringHashMapTest, Count) {
+  const StringHashMap<int> hash_map{{"one", 1}};
+  EXPECT_EQ(hash_map.Count("one"), 1);
+  EXPECT_EQ(hash_map.Count("two"), 0);
+}
+
+TEST(StringHashMapTest, Find) {
+  const StringHashMap<int> hash_map{{"one", 1}, {kLongKey, 2}};
+  EXPECT_EQ(hash_map.Find(kLongKey)->second, 2);
+  EXPECT_EQ(hash_map.Find(std::string(kLongKey.size(), 'y')), hash_map.end());
+  EXPECT_EQ(hash_map.Find("on"), hash_map.end());
+}
+
+TEST(StringHashMapTest, Contains) {
+  const StringHashMap<int> hash_map{{"", 1}};
+  EXPECT_TRUE(hash_map.Contains(""));
+  EXPECT_FALSE(hash_map.Contains(" "));
+}
+
+// Hash policy
+
+TEST(StringHashMapTest, Rehash) {
+  StringHashMap<int> hash_map{{"one", 1}, {kLongKey, 2}};
+
+  hash_map.Rehash(100);
+  EXPECT_EQ(hash_map.BucketCount(), 128);
+  EXPECT_EQ(hash_map.At("one"), 1);
+  EXPECT_EQ(hash_map.At(kLongKey), 2);
+}
+
+TEST(StringHashMapTest, Reserve) {
+  StringHashMap<int> hash_map;
+
+  hash_map.Reserve(96);
+  EXPECT_EQ(hash_map.BucketCount(), 128);
+}
+
+// Comparison operators
+
+TEST(StringHashMapTest, EqualOperator) {
+  const StringHashMap<int> a{{"one", 1}, {kLongKey, 2}};
+  const StringHashMap<int> b{{kLongKey, 2}, {"one", 1}};
+  EXPECT_EQ(a, b);
+}
+
+TEST(StringHashMapTest, NotEqualOperator) {
+  const StringHashMap<int> a{{"one", 1}, {kLongKey, 2}};
+  const StringHashMap<int> b{{"one", 1}, {kLongKey, 3}};
+  EXPECT_NE(a, b);
+}
@@ -0,0 +1,190 @@
+#ifndef CPP_ALGORITHMS_UTILITIES_BINARY_SERIALIZATION_H
+#define CPP_ALGORITHMS_UTILITIES_BINARY_SERIALIZATION_H
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+template <class T>
+constexpr bool is_pair = false;
+
+template <class T1, class T2>
+constexpr bool is_pair<std::pair<T1, T2>> = true;
+
+// Contiguous containers of trivially copyable elements (e.g. std::string) are
+// written as a 64-bit length followed by the raw element bytes.
+template <class T, class = void>
+constexpr bool is_length_prefixed = false;
+
+template <class T>
+constexpr bool is_length_prefixed<
+    T, std::void_t<typename T::value_type,
+                   decltype(std::declval<const T&>().data()),
+                   decltype(std::declval<const T&>().size()),
+                   decltype(std::declval<T&>().resize(std::size_t{}))>> =
+    std::is_trivially_copyable_v<typename T::value_type>;
+
+class BinaryWriter {
+ public:
+  static constexpr std::size_t kDefaultBufferSize{1 << 20};
+
+  explicit BinaryWriter(const int fd,
+                        const std::size_t buffer_size = kDefaultBufferSize)
+      : fd_{fd},
+        buffer_{std::make_unique<char[]>(buffer_size)},
+        capacity_{buffer_size} {}
+
+  BinaryWriter(const BinaryWriter&) = delete;
+  BinaryWriter& operator=(const BinaryWriter&) = delete;
+
+  ~BinaryWriter() {
+    try {
+      Flush();
+    } catch (...) {
+    }
+  }
+
+  template <class T>
+  void Write(const T& value) {
+    if constexpr (is_pair<T>) {
+      Write(value.first);
+      Write(value.second);
+    } else if constexpr (std::is_trivially_copyable_v<T>) {
+      WriteBytes(&value, sizeof(T));
+    } else if constexpr (is_length_prefixed<T>) {
+      Write(static_cast<std::uint64_t>(value.size()));
+      WriteBytes(value.data(), value.size() * sizeof(typename T::value_type));
+    } else {
+      static_assert(is_length_prefixed<T>, "type is not serializable");
+    }
+  }
+
+  void WriteBytes(const void* const data, const std::size_t size) {
+    if (size > capacity_ - size_) {
+      Flush();
+      if (size >= capacity_) {
+        WriteToFile(static_cast<const char*>(data), size);
+        return;
+      }
+    }
+
+    std::memcpy(buffer_.get() + size_, data, size);
+    size_ += size;
+  }
+
+  void Flush() {
+    const std::size_t size{size_};
+    size_ = 0;
+    WriteToFile(buffer_.get(), size);
+  }
+
+ private:
+  void WriteToFile(const char* data, std::size_t size) {
+    while (size > 0) {
+      const ssize_t written{::write(fd_, data, size)};
+      if (written < 0) {
+        if (errno == EINTR) continue;
+        throw std::system_error(errno, std::generic_category(), "write");
+      }
+      data += written;
+      size -= static_cast<std::size_t>(written);
+    }
+  }
+
+  int fd_;
+  std::unique_ptr<char[]> buffer_;
+  std::size_t capacity_;
+  std::size_t size_{0};
+};
+
+class BinaryReader {
+ public:
+  static constexpr std::size_t kDefaultBufferSize{1 << 20};
+
+  explicit BinaryReader(const int fd,
+                        const std::size_t buffer_size = kDefaultBufferSize)
+      : fd_{fd},
+        buffer_{std::make_unique<char[]>(buffer_size)},
+        capacity_{buffer_size} {}
+
+  BinaryReader(const BinaryReader&) = delete;
+  BinaryReader& operator=(const BinaryReader&) = delete;
+
+  template <class T>
+  T Read() {
+    if constexpr (is_pair<T>) {
+      using First = std::remove_const_t<typename T::first_type>;
+      using Second = std::remove_const_t<typename T::second_type>;
+      return T{Read<First>(), Read<Second>()};
+    } else if constexpr (std::is_trivially_copyable_v<T>) {
+      T value;
+      ReadBytes(&value, sizeof(T));
+      return value;
+    } else if constexpr (is_length_prefixed<T>) {
+      T value;
+      value.resize(static_cast<std::size_t>(Read<std::uint64_t>()));
+      ReadBytes(value.data(), value.size() * sizeof(typename T::value_type));
+      return value;
+    } else {
+      static_assert(is_length_prefixed<T>, "type is not deserializable");
+    }
+  }
+
+  void ReadBytes(void* const data, std::size_t size) {
+    char* destination{static_cast<char*>(data)};
+
+    const std::size_t buffered{std::min(size, size_ - position_)};
+    std::memcpy(destination, buffer_.get() + position_, buffered);
+    position_ += buffered;
+    destination += buffered;
+    size -= buffered;
+
+    if (size >= capacity_) {
+      ReadFromFile(destination, size, size);
+      return;
+    }
+
+    while (size > 0) {
+      size_ = ReadFromFile(buffer_.get(), 1, capacity_);
+      const std::size_t chunk{std::min(size, size_)};
+      std::memcpy(destination, buffer_.get(), chunk);
+      position_ = chunk;
+      destination += chunk;
+      size -= chunk;
+    }
+  }
+
+ private:
+  // Reads at least `min_size` and at most `max_size` bytes into `data`.
+  std::size_t ReadFromFile(char* const data, const std::size_t min_size,
+                           const std::size_t max_size) {
+    std::size_t total{0};
+    while (total < min_size) {
+      const ssize_t read{::read(fd_, data + total, max_size - total)};
+      if (read < 0) {
+        if (errno == EINTR) continue;
+        throw std::system_error(errno, std::generic_category(), "read");
+      }
+      if (read == 0) throw std::runtime_error("unexpected end of file");
+      total += static_cast<std::size_t>(read);
+    }
+    return total;
+  }
+
+  int fd_;
+  std::unique_ptr<char[]> buffer_;
+  std::size_t capacity_;
+  std::size_t size_{0};
+  std::size_t position_{0};
+};
+
+#endif  // CPP_ALGORITHMS_UTILITIES_BINARY_SERIALIZATION_H
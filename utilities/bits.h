@@ -0,0 +1,42 @@
+#ifndef CPP_ALGORITHMS_UTILITIES_BITS_H
+#define CPP_ALGORITHMS_UTILITIES_BITS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Position of the highest set bit of a non-zero value, i.e. floor(log2).
+inline std::size_t HighestBit(const std::size_t value) noexcept {
+#if defined(__GNUC__)
+  constexpr int kDigits{std::numeric_limits<unsigned long long>::digits};
+  return static_cast<std::size_t>(kDigits - 1 - __builtin_clzll(value));
+#else
+  std::size_t bit{0};
+  while ((value >> bit) > 1) ++bit;
+  return bit;
+#endif
+}
+
+// Position of the lowest set bit of a non-zero word.
+inline std::size_t LowestBit(const std::uint64_t word) noexcept {
+#if defined(__GNUC__)
+  return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+  std::size_t bit{0};
+  while (((word >> bit) & 1) == 0) ++bit;
+  return bit;
+#endif
+}
+
+// Number of set bits in a word.
+inline std::size_t PopCount(const std::uint64_t word) noexcept {
+#if defined(__GNUC__)
+  return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+  std::size_t count{0};
+  for (std::uint64_t rest{word}; rest != 0; rest &= rest - 1) ++count;
+  return count;
+#endif
+}
+
+#endif  // CPP_ALGORITHMS_UTILITIES_BITS_H
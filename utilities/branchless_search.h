@@ -0,0 +1,51 @@
+#ifndef CPP_ALGORITHMS_UTILITIES_BRANCHLESS_SEARCH_H
+#define CPP_ALGORITHMS_UTILITIES_BRANCHLESS_SEARCH_H
+
+#include <cstddef>
+
+#include "simd.h"
+
+// Binary searches over sorted contiguous elements that always take
+// ceil(log2(size)) steps and pick the next half with a conditional move
+// rather than a branch, so they do not suffer from mispredictions. Each step
+// prefetches both possible probes of the next one.
+
+// Index of the first element not ordered before `key`.
+template <class T, class Key, class Compare>
+std::size_t BranchlessLowerBound(const T* const data, std::size_t size,
+                                 const Key& key, Compare compare) {
+  if (size == 0) return 0;
+
+  const T* base{data};
+  while (size > 1) {
+    const std::size_t half{size / 2};
+    const std::size_t next_half{(size - half) / 2};
+    Prefetch(base + next_half);
+    Prefetch(base + half + next_half);
+
+    base = compare(base[half - 1], key) ? base + half : base;
+    size -= half;
+  }
+  return static_cast<std::size_t>(base - data) + compare(*base, key);
+}
+
+// Index of the first element `key` is ordered before.
+template <class T, class Key, class Compare>
+std::size_t BranchlessUpperBound(const T* const data, std::size_t size,
+                                 const Key& key, Compare compare) {
+  if (size == 0) return 0;
+
+  const T* base{data};
+  while (size > 1) {
+    const std::size_t half{size / 2};
+    const std::size_t next_half{(size - half) / 2};
+    Prefetch(base + next_half);
+    Prefetch(base + half + next_half);
+
+    base = compare(key, base[half - 1]) ? base : base + half;
+    size -= half;
+  }
+  return static_cast<std::size_t>(base - data) + !compare(key, *base);
+}
+
+#endif  // CPP_ALGORITHMS_UTILITIES_BRANCHLESS_SEARCH_H
@@ -0,0 +1,68 @@
+#ifndef CPP_ALGORITHMS_UTILITIES_GROWTH_POLICY_H
+#define CPP_ALGORITHMS_UTILITIES_GROWTH_POLICY_H
+
+#include <algorithm>
+#include <cstddef>
+
+// Growth policies decide the capacity a container reallocates to once
+// `required` elements of `element_size` bytes no longer fit in `capacity`.
+// The result is always at least `required`.
+
+// Doubles the capacity (0, 1, 2, 4, ...). Lowest number of reallocations.
+struct DoublingGrowth {
+  static std::size_t NextCapacity(const std::size_t capacity,
+                                  const std::size_t required,
+                                  const std::size_t /*element_size*/) {
+    return std::max(capacity * 2, required);
+  }
+};
+
+// Grows the capacity by half. Leaves at most a third of the block unused.
+struct OneAndHalfGrowth {
+  static std::size_t NextCapacity(const std::size_t capacity,
+                                  const std::size_t required,
+                                  const std::size_t /*element_size*/) {
+    return std::max(capacity + capacity / 2, required);
+  }
+};
+
+// Grows by half and then rounds the block up to the next malloc size class,
+// spaced four per power of two as in jemalloc and tcmalloc, so the slack the
+// allocator hands out anyway becomes usable capacity.
+struct SizeClassGrowth {
+  static std::size_t NextCapacity(const std::size_t capacity,
+                                  const std::size_t required,
+                                  const std::size_t element_size) {
+    const std::size_t count{std::max(capacity + capacity / 2, required)};
+    return std::max(SizeClass(count * element_size) / element_size, count);
+  }
+
+  static std::size_t SizeClass(const std::size_t bytes) {
+    if (bytes <= kMinSizeClass) return kMinSizeClass;
+
+    std::size_t power{kMinSizeClass};
+    while (power * 2 < bytes) power *= 2;
+
+    const std::size_t step{power / 4};
+    return (bytes + step - 1) / step * step;
+  }
+
+ private:
+  static constexpr std::size_t kMinSizeClass{16};
+};
+
+// Grows the capacity in fixed increments of `Chunk` elements. Keeps slack
+// bounded for arrays that grow slowly, at the price of linear reallocations.
+template <std::size_t Chunk>
+struct FixedChunkGrowth {
+  static_assert(Chunk > 0, "chunk must not be empty");
+
+  static std::size_t NextCapacity(const std::size_t capacity,
+                                  const std::size_t required,
+                                  const std::size_t /*element_size*/) {
+    const std::size_t count{std::max(capacity + Chunk, required)};
+    return (count + Chunk - 1) / Chunk * Chunk;
+  }
+};
+
+#endif  // CPP_ALGORITHMS_UTILITIES_GROWTH_POLICY_H
@@ -0,0 +1,20 @@
+#ifndef CPP_ALGORITHMS_UTILITIES_HAS_REALLOCATE_H
+#define CPP_ALGORITHMS_UTILITIES_HAS_REALLOCATE_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// Whether `Allocator` can resize a block with
+// `reallocate(pointer, old_count, new_count)`, moving its bytes if needed.
+template <class Allocator, class = void>
+constexpr bool has_reallocate = false;
+
+template <class Allocator>
+constexpr bool has_reallocate<
+    Allocator,
+    std::void_t<decltype(std::declval<Allocator&>().reallocate(
+        std::declval<typename Allocator::value_type*>(),
+        std::declval<std::size_t>(), std::declval<std::size_t>()))>> = true;
+
+#endif  // CPP_ALGORITHMS_UTILITIES_HAS_REALLOCATE_H
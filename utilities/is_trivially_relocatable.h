@@ -0,0 +1,12 @@
+#ifndef CPP_ALGORITHMS_UTILITIES_IS_TRIVIALLY_RELOCATABLE_H
+#define CPP_ALGORITHMS_UTILITIES_IS_TRIVIALLY_RELOCATABLE_H
+
+#include <type_traits>
+
+// Whether an object can be moved to a new address by copying its bytes and
+// abandoning the original without running its destructor. Specialize it for
+// types such as owning handles that qualify without being trivially copyable.
+template <class T>
+constexpr bool is_trivially_relocatable = std::is_trivially_copyable_v<T>;
+
+#endif  // CPP_ALGORITHMS_UTILITIES_IS_TRIVIALLY_RELOCATABLE_H
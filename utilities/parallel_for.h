@@ -0,0 +1,66 @@
+#ifndef CPP_ALGORITHMS_UTILITIES_PARALLEL_FOR_H
+#define CPP_ALGORITHMS_UTILITIES_PARALLEL_FOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+#include "dynamic_array.h"
+
+inline std::size_t DefaultThreadCount() {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Calls `function(i)` for every i in [0, task_count) on up to `thread_count`
+// threads. Tasks are handed out dynamically, and the first exception thrown
+// by a task is rethrown on the calling thread once all workers have joined.
+// When a thread cannot be started, the tasks run on the threads that were.
+template <class Function>
+void ParallelFor(const std::size_t task_count, std::size_t thread_count,
+                 Function&& function) {
+  thread_count = std::min(std::max<std::size_t>(thread_count, 1), task_count);
+  if (thread_count <= 1) {
+    for (std::size_t i{0}; i < task_count; ++i) {
+      function(i);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next_task{0};
+  std::exception_ptr exception;
+  std::mutex exception_mutex;
+
+  auto worker = [&]() -> void {
+    for (std::size_t i{next_task++}; i < task_count; i = next_task++) {
+      try {
+        function(i);
+      } catch (...) {
+        const std::lock_guard<std::mutex> lock{exception_mutex};
+        if (!exception) exception = std::current_exception();
+        next_task = task_count;
+      }
+    }
+  };
+
+  DynamicArray<std::thread> threads;
+  threads.Reserve(thread_count - 1);
+  try {
+    for (std::size_t i{1}; i < thread_count; ++i) {
+      threads.EmplaceBack(worker);
+    }
+  } catch (const std::system_error&) {
+    // Out of threads: the ones already started take the remaining tasks.
+  }
+  worker();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  if (exception) std::rethrow_exception(exception);
+}
+
+#endif  // CPP_ALGORITHMS_UTILITIES_PARALLEL_FOR_H
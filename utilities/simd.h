@@ -0,0 +1,665 @@
+#ifndef CPP_ALGORITHMS_UTILITIES_SIMD_H
+#define CPP_ALGORITHMS_UTILITIES_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "bits.h"
+
+#if defined(__GNUC__) && defined(__SSE2__)
+#define CPP_ALGORITHMS_SIMD_X86
+#include <immintrin.h>
+#endif
+
+// Linear scans over contiguous elements. For arithmetic types they run on
+// SSE2, or on AVX2 when the CPU supports it, and compare elements the same
+// way as the scalar loops (e.g. NaN never compares equal). Other types and
+// other platforms use the scalar loops.
+
+template <class T>
+constexpr bool is_simd_comparable =
+    (std::is_integral_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 ||
+                               sizeof(T) == 4 || sizeof(T) == 8)) ||
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+// Types whose lanes can also be ordered, which excludes bool.
+template <class T>
+constexpr bool is_simd_orderable =
+    is_simd_comparable<T> && !std::is_same_v<T, bool>;
+
+// Scalar kernels
+
+template <class T>
+std::size_t ScalarFind(const T* const data, const std::size_t size,
+                       const T& value) {
+  for (std::size_t i{0}; i < size; ++i) {
+    if (data[i] == value) return i;
+  }
+  return size;
+}
+
+template <class T>
+std::size_t ScalarCount(const T* const data, const std::size_t size,
+                        const T& value) {
+  std::size_t count{0};
+  for (std::size_t i{0}; i < size; ++i) {
+    count += data[i] == value;
+  }
+  return count;
+}
+
+template <class T>
+void ScalarFill(T* const data, const std::size_t size, const T& value) {
+  for (std::size_t i{0}; i < size; ++i) {
+    data[i] = value;
+  }
+}
+
+template <class T>
+std::size_t ScalarMismatch(const T* const a, const T* const b,
+                           const std::size_t size) {
+  for (std::size_t i{0}; i < size; ++i) {
+    if (a[i] != b[i]) return i;
+  }
+  return size;
+}
+
+// Number of elements less than `value`, or greater with `Greater` set.
+template <bool Greater, class T>
+std::size_t ScalarCountOrdered(const T* const data, const std::size_t size,
+                               const T& value) {
+  std::size_t count{0};
+  for (std::size_t i{0}; i < size; ++i) {
+    count += Greater ? value < data[i] : data[i] < value;
+  }
+  return count;
+}
+
+// Word-wise operations combining one bitmap into another.
+enum class BitwiseOp { kAnd, kOr, kXor, kAndNot };
+
+template <BitwiseOp Op>
+std::uint64_t ApplyBitwise(const std::uint64_t a, const std::uint64_t b) {
+  if constexpr (Op == BitwiseOp::kAnd) {
+    return a & b;
+  } else if constexpr (Op == BitwiseOp::kOr) {
+    return a | b;
+  } else if constexpr (Op == BitwiseOp::kXor) {
+    return a ^ b;
+  } else {
+    return a & ~b;
+  }
+}
+
+template <BitwiseOp Op>
+void ScalarBitwise(std::uint64_t* const destination,
+                   const std::uint64_t* const source, const std::size_t size) {
+  for (std::size_t i{0}; i < size; ++i) {
+    destination[i] = ApplyBitwise<Op>(destination[i], source[i]);
+  }
+}
+
+inline std::size_t ScalarPopCount(const std::uint64_t* const data,
+                                  const std::size_t size) {
+  std::size_t count{0};
+  for (std::size_t i{0}; i < size; ++i) {
+    count += PopCount(data[i]);
+  }
+  return count;
+}
+
+#ifdef CPP_ALGORITHMS_SIMD_X86
+
+inline bool HasAvx2() {
+  static const bool has_avx2{[] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+  }()};
+  return has_avx2;
+}
+
+// Broadcasts and comparisons produce a byte mask with the bytes of equal
+// lanes set, so that lane i of a T starts at bit i * sizeof(T).
+
+template <class T>
+__m128i Sse2Broadcast(const T value) {
+  if constexpr (sizeof(T) == 1) {
+    char bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return _mm_set1_epi8(bits);
+  } else if constexpr (sizeof(T) == 2) {
+    short bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return _mm_set1_epi16(bits);
+  } else if constexpr (sizeof(T) == 4) {
+    int bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return _mm_set1_epi32(bits);
+  } else {
+    long long bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return _mm_set1_epi64x(bits);
+  }
+}
+
+template <class T>
+std::uint32_t Sse2EqualMask(const __m128i a, const __m128i b) {
+  __m128i equal;
+  if constexpr (std::is_same_v<T, float>) {
+    equal = _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a),
+                                          _mm_castsi128_ps(b)));
+  } else if constexpr (std::is_same_v<T, double>) {
+    equal = _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a),
+                                          _mm_castsi128_pd(b)));
+  } else if constexpr (sizeof(T) == 1) {
+    equal = _mm_cmpeq_epi8(a, b);
+  } else if constexpr (sizeof(T) == 2) {
+    equal = _mm_cmpeq_epi16(a, b);
+  } else if constexpr (sizeof(T) == 4) {
+    equal = _mm_cmpeq_epi32(a, b);
+  } else {
+    // SSE2 has no 64-bit compare: both halves must be equal.
+    const __m128i halves{_mm_cmpeq_epi32(a, b)};
+    equal = _mm_and_si128(halves,
+                          _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+  }
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(equal));
+}
+
+inline __m128i Sse2Load(const void* const data) {
+  return _mm_loadu_si128(static_cast<const __m128i*>(data));
+}
+
+template <class T>
+std::size_t Sse2Find(const T* const data, const std::size_t size,
+                     const T value) {
+  constexpr std::size_t kLanes{16 / sizeof(T)};
+  const __m128i needle{Sse2Broadcast(value)};
+
+  std::size_t i{0};
+  for (; i + kLanes <= size; i += kLanes) {
+    const std::uint32_t mask{Sse2EqualMask<T>(Sse2Load(data + i), needle)};
+    if (mask != 0) return i + __builtin_ctz(mask) / sizeof(T);
+  }
+  return i + ScalarFind(data + i, size - i, value);
+}
+
+template <class T>
+std::size_t Sse2Count(const T* const data, const std::size_t size,
+                      const T value) {
+  constexpr std::size_t kLanes{16 / sizeof(T)};
+  const __m128i needle{Sse2Broadcast(value)};
+
+  std::size_t i{0};
+  std::size_t bytes{0};
+  for (; i + kLanes <= size; i += kLanes) {
+    bytes += __builtin_popcount(Sse2EqualMask<T>(Sse2Load(data + i), needle));
+  }
+  return bytes / sizeof(T) + ScalarCount(data + i, size - i, value);
+}
+
+template <class T>
+void Sse2Fill(T* const data, const std::size_t size, const T value) {
+  constexpr std::size_t kLanes{16 / sizeof(T)};
+  const __m128i fill{Sse2Broadcast(value)};
+
+  std::size_t i{0};
+  for (; i + kLanes <= size; i += kLanes) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), fill);
+  }
+  ScalarFill(data + i, size - i, value);
+}
+
+template <class T>
+std::size_t Sse2Mismatch(const T* const a, const T* const b,
+                         const std::size_t size) {
+  constexpr std::size_t kLanes{16 / sizeof(T)};
+
+  std::size_t i{0};
+  for (; i + kLanes <= size; i += kLanes) {
+    const std::uint32_t mask{
+        Sse2EqualMask<T>(Sse2Load(a + i), Sse2Load(b + i))};
+    if (mask != 0xFFFF) return i + __builtin_ctz(~mask) / sizeof(T);
+  }
+  return i + ScalarMismatch(a + i, b + i, size - i);
+}
+
+// Byte mask of the lanes where `a` is less than `b`. SSE2 has no 64-bit
+// integer ordering, so callers keep those types on the scalar loops.
+template <class T>
+std::uint32_t Sse2LessMask(__m128i a, __m128i b) {
+  __m128i less;
+  if constexpr (std::is_same_v<T, float>) {
+    less = _mm_castps_si128(_mm_cmplt_ps(_mm_castsi128_ps(a),
+                                         _mm_castsi128_ps(b)));
+  } else if constexpr (std::is_same_v<T, double>) {
+    less = _mm_castpd_si128(_mm_cmplt_pd(_mm_castsi128_pd(a),
+                                         _mm_castsi128_pd(b)));
+  } else {
+    static_assert(sizeof(T) <= 4, "no 64-bit integer ordering in SSE2");
+    if constexpr (std::is_unsigned_v<T>) {
+      // Flipping the sign bits maps unsigned order onto signed order.
+      const __m128i sign{Sse2Broadcast(
+          static_cast<T>(T{1} << (sizeof(T) * 8 - 1)))};
+      a = _mm_xor_si128(a, sign);
+      b = _mm_xor_si128(b, sign);
+    }
+    if constexpr (sizeof(T) == 1) {
+      less = _mm_cmplt_epi8(a, b);
+    } else if constexpr (sizeof(T) == 2) {
+      less = _mm_cmplt_epi16(a, b);
+    } else {
+      less = _mm_cmplt_epi32(a, b);
+    }
+  }
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(less));
+}
+
+template <bool Greater, class T>
+std::size_t Sse2CountOrdered(const T* const data, const std::size_t size,
+                             const T value) {
+  constexpr std::size_t kLanes{16 / sizeof(T)};
+  const __m128i pivot{Sse2Broadcast(value)};
+
+  std::size_t i{0};
+  std::size_t bytes{0};
+  for (; i + kLanes <= size; i += kLanes) {
+    const __m128i lanes{Sse2Load(data + i)};
+    bytes += __builtin_popcount(Greater ? Sse2LessMask<T>(pivot, lanes)
+                                        : Sse2LessMask<T>(lanes, pivot));
+  }
+  return bytes / sizeof(T) +
+         ScalarCountOrdered<Greater>(data + i, size - i, value);
+}
+
+template <BitwiseOp Op>
+__m128i Sse2ApplyBitwise(const __m128i a, const __m128i b) {
+  if constexpr (Op == BitwiseOp::kAnd) {
+    return _mm_and_si128(a, b);
+  } else if constexpr (Op == BitwiseOp::kOr) {
+    return _mm_or_si128(a, b);
+  } else if constexpr (Op == BitwiseOp::kXor) {
+    return _mm_xor_si128(a, b);
+  } else {
+    return _mm_andnot_si128(b, a);
+  }
+}
+
+template <BitwiseOp Op>
+void Sse2Bitwise(std::uint64_t* const destination,
+                 const std::uint64_t* const source, const std::size_t size) {
+  std::size_t i{0};
+  for (; i + 2 <= size; i += 2) {
+    const __m128i result{Sse2ApplyBitwise<Op>(Sse2Load(destination + i),
+                                              Sse2Load(source + i))};
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), result);
+  }
+  ScalarBitwise<Op>(destination + i, source + i, size - i);
+}
+
+#define CPP_ALGORITHMS_TARGET_AVX2 __attribute__((target("avx2")))
+
+template <class T>
+CPP_ALGORITHMS_TARGET_AVX2 __m256i Avx2Broadcast(const T value) {
+  if constexpr (sizeof(T) == 1) {
+    char bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return _mm256_set1_epi8(bits);
+  } else if constexpr (sizeof(T) == 2) {
+    short bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return _mm256_set1_epi16(bits);
+  } else if constexpr (sizeof(T) == 4) {
+    int bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return _mm256_set1_epi32(bits);
+  } else {
+    long long bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return _mm256_set1_epi64x(bits);
+  }
+}
+
+template <class T>
+CPP_ALGORITHMS_TARGET_AVX2 std::uint32_t Avx2EqualMask(const __m256i a,
+                                                       const __m256i b) {
+  __m256i equal;
+  if constexpr (std::is_same_v<T, float>) {
+    equal = _mm256_castps_si256(_mm256_cmp_ps(
+        _mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+  } else if constexpr (std::is_same_v<T, double>) {
+    equal = _mm256_castpd_si256(_mm256_cmp_pd(
+        _mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+  } else if constexpr (sizeof(T) == 1) {
+    equal = _mm256_cmpeq_epi8(a, b);
+  } else if constexpr (sizeof(T) == 2) {
+    equal = _mm256_cmpeq_epi16(a, b);
+  } else if constexpr (sizeof(T) == 4) {
+    equal = _mm256_cmpeq_epi32(a, b);
+  } else {
+    equal = _mm256_cmpeq_epi64(a, b);
+  }
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(equal));
+}
+
+CPP_ALGORITHMS_TARGET_AVX2 inline __m256i Avx2Load(const void* const data) {
+  return _mm256_loadu_si256(static_cast<const __m256i*>(data));
+}
+
+template <class T>
+CPP_ALGORITHMS_TARGET_AVX2 std::size_t Avx2Find(const T* const data,
+                                                const std::size_t size,
+                                                const T value) {
+  constexpr std::size_t kLanes{32 / sizeof(T)};
+  const __m256i needle{Avx2Broadcast(value)};
+
+  std::size_t i{0};
+  for (; i + kLanes <= size; i += kLanes) {
+    const std::uint32_t mask{Avx2EqualMask<T>(Avx2Load(data + i), needle)};
+    if (mask != 0) return i + __builtin_ctz(mask) / sizeof(T);
+  }
+  return i + ScalarFind(data + i, size - i, value);
+}
+
+template <class T>
+CPP_ALGORITHMS_TARGET_AVX2 std::size_t Avx2Count(const T* const data,
+                                                 const std::size_t size,
+                                                 const T value) {
+  constexpr std::size_t kLanes{32 / sizeof(T)};
+  const __m256i needle{Avx2Broadcast(value)};
+
+  std::size_t i{0};
+  std::size_t bytes{0};
+  for (; i + kLanes <= size; i += kLanes) {
+    bytes += __builtin_popcount(Avx2EqualMask<T>(Avx2Load(data + i), needle));
+  }
+  return bytes / sizeof(T) + ScalarCount(data + i, size - i, value);
+}
+
+template <class T>
+CPP_ALGORITHMS_TARGET_AVX2 void Avx2Fill(T* const data,
+                                         const std::size_t size,
+                                         const T value) {
+  constexpr std::size_t kLanes{32 / sizeof(T)};
+  const __m256i fill{Avx2Broadcast(value)};
+
+  std::size_t i{0};
+  for (; i + kLanes <= size; i += kLanes) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), fill);
+  }
+  ScalarFill(data + i, size - i, value);
+}
+
+template <class T>
+CPP_ALGORITHMS_TARGET_AVX2 std::size_t Avx2Mismatch(const T* const a,
+                                                    const T* const b,
+                                                    const std::size_t size) {
+  constexpr std::size_t kLanes{32 / sizeof(T)};
+
+  std::size_t i{0};
+  for (; i + kLanes <= size; i += kLanes) {
+    const std::uint32_t mask{
+        Avx2EqualMask<T>(Avx2Load(a + i), Avx2Load(b + i))};
+    if (mask != 0xFFFFFFFF) return i + __builtin_ctz(~mask) / sizeof(T);
+  }
+  return i + ScalarMismatch(a + i, b + i, size - i);
+}
+
+template <class T>
+CPP_ALGORITHMS_TARGET_AVX2 std::uint32_t Avx2LessMask(__m256i a, __m256i b) {
+  __m256i less;
+  if constexpr (std::is_same_v<T, float>) {
+    less = _mm256_castps_si256(_mm256_cmp_ps(
+        _mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_LT_OQ));
+  } else if constexpr (std::is_same_v<T, double>) {
+    less = _mm256_castpd_si256(_mm256_cmp_pd(
+        _mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_LT_OQ));
+  } else {
+    if constexpr (std::is_unsigned_v<T>) {
+      const __m256i sign{Avx2Broadcast(
+          static_cast<T>(T{1} << (sizeof(T) * 8 - 1)))};
+      a = _mm256_xor_si256(a, sign);
+      b = _mm256_xor_si256(b, sign);
+    }
+    if constexpr (sizeof(T) == 1) {
+      less = _mm256_cmpgt_epi8(b, a);
+    } else if constexpr (sizeof(T) == 2) {
+      less = _mm256_cmpgt_epi16(b, a);
+    } else if constexpr (sizeof(T) == 4) {
+      less = _mm256_cmpgt_epi32(b, a);
+    } else {
+      less = _mm256_cmpgt_epi64(b, a);
+    }
+  }
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(less));
+}
+
+template <bool Greater, class T>
+CPP_ALGORITHMS_TARGET_AVX2 std::size_t Avx2CountOrdered(
+    const T* const data, const std::size_t size, const T value) {
+  constexpr std::size_t kLanes{32 / sizeof(T)};
+  const __m256i pivot{Avx2Broadcast(value)};
+
+  std::size_t i{0};
+  std::size_t bytes{0};
+  for (; i + kLanes <= size; i += kLanes) {
+    const __m256i lanes{Avx2Load(data + i)};
+    bytes += __builtin_popcount(Greater ? Avx2LessMask<T>(pivot, lanes)
+                                        : Avx2LessMask<T>(lanes, pivot));
+  }
+  return bytes / sizeof(T) +
+         ScalarCountOrdered<Greater>(data + i, size - i, value);
+}
+
+template <BitwiseOp Op>
+CPP_ALGORITHMS_TARGET_AVX2 __m256i Avx2ApplyBitwise(const __m256i a,
+                                                    const __m256i b) {
+  if constexpr (Op == BitwiseOp::kAnd) {
+    return _mm256_and_si256(a, b);
+  } else if constexpr (Op == BitwiseOp::kOr) {
+    return _mm256_or_si256(a, b);
+  } else if constexpr (Op == BitwiseOp::kXor) {
+    return _mm256_xor_si256(a, b);
+  } else {
+    return _mm256_andnot_si256(b, a);
+  }
+}
+
+template <BitwiseOp Op>
+CPP_ALGORITHMS_TARGET_AVX2 void Avx2Bitwise(std::uint64_t* const destination,
+                                            const std::uint64_t* const source,
+                                            const std::size_t size) {
+  std::size_t i{0};
+  for (; i + 4 <= size; i += 4) {
+    const __m256i result{Avx2ApplyBitwise<Op>(Avx2Load(destination + i),
+                                              Avx2Load(source + i))};
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), result);
+  }
+  ScalarBitwise<Op>(destination + i, source + i, size - i);
+}
+
+// Counts bits by looking up each nibble in a 16-entry table with a byte
+// shuffle and summing the bytes of every 64-bit lane.
+CPP_ALGORITHMS_TARGET_AVX2 inline std::size_t Avx2PopCount(
+    const std::uint64_t* const data, const std::size_t size) {
+  const __m256i lookup{_mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2,
+                                        3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2,
+                                        2, 3, 2, 3, 3, 4)};
+  const __m256i low_nibbles{_mm256_set1_epi8(0x0F)};
+
+  std::size_t i{0};
+  __m256i total{_mm256_setzero_si256()};
+  for (; i + 4 <= size; i += 4) {
+    const __m256i words{Avx2Load(data + i)};
+    const __m256i low{_mm256_and_si256(words, low_nibbles)};
+    const __m256i high{
+        _mm256_and_si256(_mm256_srli_epi16(words, 4), low_nibbles)};
+    const __m256i counts{_mm256_add_epi8(_mm256_shuffle_epi8(lookup, low),
+                                         _mm256_shuffle_epi8(lookup, high))};
+    total = _mm256_add_epi64(
+        total, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+  }
+
+  std::uint64_t lanes[4];
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), total);
+  return static_cast<std::size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]) +
+         ScalarPopCount(data + i, size - i);
+}
+
+#undef CPP_ALGORITHMS_TARGET_AVX2
+
+#endif  // CPP_ALGORITHMS_SIMD_X86
+
+// Dispatch. Ranges shorter than a vector go straight to the scalar loops.
+
+template <class T>
+std::size_t SimdFind(const T* const data, const std::size_t size,
+                     const T& value) {
+#ifdef CPP_ALGORITHMS_SIMD_X86
+  if constexpr (is_simd_comparable<T>) {
+    if (size >= 32 / sizeof(T) && HasAvx2()) {
+      return Avx2Find(data, size, value);
+    }
+    if (size >= 16 / sizeof(T)) return Sse2Find(data, size, value);
+  }
+#endif
+  return ScalarFind(data, size, value);
+}
+
+template <class T>
+std::size_t SimdCount(const T* const data, const std::size_t size,
+                      const T& value) {
+#ifdef CPP_ALGORITHMS_SIMD_X86
+  if constexpr (is_simd_comparable<T>) {
+    if (size >= 32 / sizeof(T) && HasAvx2()) {
+      return Avx2Count(data, size, value);
+    }
+    if (size >= 16 / sizeof(T)) return Sse2Count(data, size, value);
+  }
+#endif
+  return ScalarCount(data, size, value);
+}
+
+template <class T>
+void SimdFill(T* const data, const std::size_t size, const T& value) {
+#ifdef CPP_ALGORITHMS_SIMD_X86
+  if constexpr (is_simd_comparable<T>) {
+    if (size >= 32 / sizeof(T) && HasAvx2()) {
+      Avx2Fill(data, size, value);
+      return;
+    }
+    if (size >= 16 / sizeof(T)) {
+      Sse2Fill(data, size, value);
+      return;
+    }
+  }
+#endif
+  ScalarFill(data, size, value);
+}
+
+// Index of the first position where `a` and `b` differ, or `size`.
+template <class T>
+std::size_t SimdMismatch(const T* const a, const T* const b,
+                         const std::size_t size) {
+#ifdef CPP_ALGORITHMS_SIMD_X86
+  if constexpr (is_simd_comparable<T>) {
+    if (size >= 32 / sizeof(T) && HasAvx2()) return Avx2Mismatch(a, b, size);
+    if (size >= 16 / sizeof(T)) return Sse2Mismatch(a, b, size);
+  }
+#endif
+  return ScalarMismatch(a, b, size);
+}
+
+template <bool Greater, class T>
+std::size_t SimdCountOrdered(const T* const data, const std::size_t size,
+                             const T& value) {
+#ifdef CPP_ALGORITHMS_SIMD_X86
+  if constexpr (is_simd_orderable<T>) {
+    if (size >= 32 / sizeof(T) && HasAvx2()) {
+      return Avx2CountOrdered<Greater>(data, size, value);
+    }
+    if constexpr (std::is_floating_point_v<T> || sizeof(T) <= 4) {
+      if (size >= 16 / sizeof(T)) {
+        return Sse2CountOrdered<Greater>(data, size, value);
+      }
+    }
+  }
+#endif
+  return ScalarCountOrdered<Greater>(data, size, value);
+}
+
+// Number of elements less than `value`.
+template <class T>
+std::size_t SimdCountLess(const T* const data, const std::size_t size,
+                          const T& value) {
+  return SimdCountOrdered<false>(data, size, value);
+}
+
+// Number of elements greater than `value`.
+template <class T>
+std::size_t SimdCountGreater(const T* const data, const std::size_t size,
+                             const T& value) {
+  return SimdCountOrdered<true>(data, size, value);
+}
+
+template <class T>
+bool SimdEqual(const T* const a, const T* const b, const std::size_t size) {
+  return SimdMismatch(a, b, size) == size;
+}
+
+// Like std::lexicographical_compare: whether `a` orders before `b`.
+template <class T>
+bool SimdLexicographicalCompare(const T* const a, const std::size_t a_size,
+                                const T* const b, const std::size_t b_size) {
+  const std::size_t size{a_size < b_size ? a_size : b_size};
+
+  // Unequal but unordered elements (NaN) do not decide the order.
+  for (std::size_t i{SimdMismatch(a, b, size)}; i < size;) {
+    if (a[i] < b[i]) return true;
+    if (b[i] < a[i]) return false;
+
+    ++i;
+    i += SimdMismatch(a + i, b + i, size - i);
+  }
+  return a_size < b_size;
+}
+
+// Sets destination[i] to destination[i] op source[i] over `size` words.
+template <BitwiseOp Op>
+void SimdBitwise(std::uint64_t* const destination,
+                 const std::uint64_t* const source, const std::size_t size) {
+#ifdef CPP_ALGORITHMS_SIMD_X86
+  if (size >= 4 && HasAvx2()) {
+    Avx2Bitwise<Op>(destination, source, size);
+    return;
+  }
+  if (size >= 2) {
+    Sse2Bitwise<Op>(destination, source, size);
+    return;
+  }
+#endif
+  ScalarBitwise<Op>(destination, source, size);
+}
+
+// Number of set bits in `size` words.
+inline std::size_t SimdPopCount(const std::uint64_t* const data,
+                                const std::size_t size) {
+#ifdef CPP_ALGORITHMS_SIMD_X86
+  if (size >= 4 && HasAvx2()) return Avx2PopCount(data, size);
+#endif
+  return ScalarPopCount(data, size);
+}
+
+// Hints the cache line holding `address` into the cache. The address does not
+// need to be valid.
+inline void Prefetch(const void* const address) noexcept {
+#ifdef __GNUC__
+  __builtin_prefetch(address);
+#else
+  static_cast<void>(address);
+#endif
+}
+
+#endif  // CPP_ALGORITHMS_UTILITIES_SIMD_H
@@ -0,0 +1,52 @@
+#ifndef CPP_ALGORITHMS_UTILITIES_SPAN_H
+#define CPP_ALGORITHMS_UTILITIES_SPAN_H
+
+#include <cstddef>
+#include <type_traits>
+
+// Non-owning view of `size` contiguous objects, a minimal std::span.
+template <class T>
+class Span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+  using iterator = T*;
+
+  Span() noexcept = default;
+
+  Span(T* const data, const size_type size) noexcept
+      : data_{data}, size_{size} {}
+
+  reference operator[](const size_type index) const { return data_[index]; }
+
+  pointer Data() const noexcept { return data_; }
+
+  iterator begin() const noexcept { return data_; }
+  iterator end() const noexcept { return data_ + size_; }
+
+  bool Empty() const noexcept { return size_ == 0; }
+
+  size_type Size() const noexcept { return size_; }
+
+  size_type SizeBytes() const noexcept { return size_ * sizeof(T); }
+
+  Span First(const size_type count) const { return {data_, count}; }
+
+  Span Last(const size_type count) const {
+    return {data_ + size_ - count, count};
+  }
+
+  Span Subspan(const size_type offset, const size_type count) const {
+    return {data_ + offset, count};
+  }
+
+ private:
+  T* data_{nullptr};
+  std::size_t size_{0};
+};
+
+#endif  // CPP_ALGORITHMS_UTILITIES_SPAN_H